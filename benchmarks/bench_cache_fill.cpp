@@ -0,0 +1,170 @@
+/**
+ * @file bench_cache_fill.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/non_propagating_cache.hpp"
+#include "dd/slice_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <ranges>
+
+namespace
+{
+
+/**
+ * @brief Number of iterator copies and moves, reported as a counter.
+ */
+auto heavy_copies = std::int64_t{0};
+
+/**
+ * @brief A forward iterator with a large payload, which is expensive to copy.
+ * @details Stands in for iterators of nested adaptors that carry large state, e.g.
+ * join_view iterators over nested filter_views.
+ */
+class heavy_iterator
+{
+public:
+  using value_type = int;
+  using difference_type = std::ptrdiff_t;
+
+  heavy_iterator() = default;
+
+  explicit heavy_iterator(std::list<int>::iterator iter) : iter_{iter} {}
+
+  heavy_iterator(heavy_iterator const& other)
+      : iter_{other.iter_}, payload_{other.payload_}
+  {
+    ++heavy_copies;
+  }
+
+  heavy_iterator(heavy_iterator&& other) noexcept
+      : iter_{other.iter_}, payload_{other.payload_}
+  {
+    ++heavy_copies;
+  }
+
+  auto operator=(heavy_iterator const& other) -> heavy_iterator&
+  {
+    iter_ = other.iter_;
+    payload_ = other.payload_;
+    ++heavy_copies;
+    return *this;
+  }
+
+  auto operator=(heavy_iterator&& other) noexcept -> heavy_iterator&
+  {
+    iter_ = other.iter_;
+    payload_ = other.payload_;
+    ++heavy_copies;
+    return *this;
+  }
+
+  auto operator*() const -> int& { return *iter_; }
+
+  auto operator++() -> heavy_iterator&
+  {
+    ++iter_;
+    return *this;
+  }
+
+  auto operator++(int) -> heavy_iterator
+  {
+    auto tmp = *this;
+    ++iter_;
+    return tmp;
+  }
+
+  friend auto operator==(heavy_iterator const& x, heavy_iterator const& y) -> bool
+  {
+    return x.iter_ == y.iter_;
+  }
+
+private:
+  std::list<int>::iterator iter_{};
+  std::array<std::int64_t, 64> payload_{};
+};
+
+static_assert(std::forward_iterator<heavy_iterator>);
+
+constexpr auto size = std::int64_t{1} << 10;
+
+auto make_list() -> std::list<int>
+{
+  auto data = std::list<int>{};
+  for (auto i = 0; i < size; ++i)
+  {
+    data.push_back(i);
+  }
+  return data;
+}
+
+/**
+ * @brief Fills a std::optional from the result of a function, moving it into place.
+ */
+void bm_optional_emplace(benchmark::State& state)
+{
+  auto data = make_list();
+  heavy_copies = 0;
+  for (auto _ : state)
+  {
+    auto cache = std::optional<heavy_iterator>{};
+    auto make = [&] { return heavy_iterator{data.begin()}; };
+    benchmark::DoNotOptimize(cache.emplace(make()));
+  }
+  state.counters["copies"] = benchmark::Counter(
+    static_cast<double>(heavy_copies), benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * @brief Fills a non_propagating_cache, which constructs the result in place.
+ */
+void bm_cache_get_or_emplace(benchmark::State& state)
+{
+  auto data = make_list();
+  heavy_copies = 0;
+  for (auto _ : state)
+  {
+    auto cache = dd::non_propagating_cache<heavy_iterator>{};
+    benchmark::DoNotOptimize(
+      cache.get_or_emplace([&] { return heavy_iterator{data.begin()}; }));
+  }
+  state.counters["copies"] = benchmark::Counter(
+    static_cast<double>(heavy_copies), benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * @brief Locates and caches both ends of a slice over heavy iterators.
+ */
+void bm_slice_fill(benchmark::State& state)
+{
+  auto data = make_list();
+  auto base =
+    std::ranges::subrange(heavy_iterator{data.begin()}, heavy_iterator{data.end()});
+  heavy_copies = 0;
+  for (auto _ : state)
+  {
+    auto slice = dd::ranges::slice_view(base, 16, 32);
+    benchmark::DoNotOptimize(std::ranges::begin(slice) == std::ranges::end(slice));
+  }
+  state.counters["copies"] = benchmark::Counter(
+    static_cast<double>(heavy_copies), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(bm_optional_emplace);
+BENCHMARK(bm_cache_get_or_emplace);
+BENCHMARK(bm_slice_fill);
+
+} // namespace
@@ -0,0 +1,107 @@
+/**
+ * @file bench_copy_slice.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/copy_slice.hpp"
+#include "dd/slice_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+namespace
+{
+
+constexpr auto size = std::int64_t{1} << 16;
+
+template <typename Container>
+auto make_data() -> Container
+{
+  auto data = Container(static_cast<std::size_t>(size));
+  std::iota(data.begin(), data.end(), std::int64_t{0});
+  return data;
+}
+
+/**
+ * @brief Materializes a slice_view of a std::vector with std::ranges::to.
+ */
+void bm_vector_ranges_to(benchmark::State& state)
+{
+  auto data = make_data<std::vector<std::int64_t>>();
+  for (auto _ : state)
+  {
+    auto sliced = dd::ranges::slice_view(data, 1, size - 1);
+    benchmark::DoNotOptimize(std::ranges::to<std::vector>(sliced));
+  }
+  state.SetBytesProcessed(state.iterations() * (size - 2) * sizeof(std::int64_t));
+}
+
+/**
+ * @brief Materializes a slice_view of a std::vector with slice_to.
+ */
+void bm_vector_slice_to(benchmark::State& state)
+{
+  auto data = make_data<std::vector<std::int64_t>>();
+  for (auto _ : state)
+  {
+    auto sliced = dd::ranges::slice_view(data, 1, size - 1);
+    benchmark::DoNotOptimize(dd::ranges::slice_to<std::vector>(sliced));
+  }
+  state.SetBytesProcessed(state.iterations() * (size - 2) * sizeof(std::int64_t));
+}
+
+/**
+ * @brief Copies a slice into an existing buffer with std::ranges::copy.
+ * @tparam Container The container of the sliced elements.
+ */
+template <typename Container>
+void bm_ranges_copy(benchmark::State& state)
+{
+  auto data = make_data<Container>();
+  auto out = std::vector<std::int64_t>(static_cast<std::size_t>(size));
+  for (auto _ : state)
+  {
+    auto sliced = dd::ranges::slice_view(data, 1, size - 1);
+    benchmark::DoNotOptimize(std::ranges::copy(sliced, out.data()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * (size - 2) * sizeof(std::int64_t));
+}
+
+/**
+ * @brief Copies a slice into an existing buffer with copy_slice.
+ * @tparam Container The container of the sliced elements.
+ */
+template <typename Container>
+void bm_copy_slice(benchmark::State& state)
+{
+  auto data = make_data<Container>();
+  auto out = std::vector<std::int64_t>(static_cast<std::size_t>(size));
+  for (auto _ : state)
+  {
+    auto sliced = dd::ranges::slice_view(data, 1, size - 1);
+    benchmark::DoNotOptimize(dd::ranges::copy_slice(sliced, out.data()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * (size - 2) * sizeof(std::int64_t));
+}
+
+BENCHMARK(bm_vector_ranges_to);
+BENCHMARK(bm_vector_slice_to);
+BENCHMARK(bm_ranges_copy<std::vector<std::int64_t>>);
+BENCHMARK(bm_copy_slice<std::vector<std::int64_t>>);
+BENCHMARK(bm_ranges_copy<std::deque<std::int64_t>>);
+BENCHMARK(bm_copy_slice<std::deque<std::int64_t>>);
+
+} // namespace
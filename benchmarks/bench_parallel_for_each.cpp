@@ -0,0 +1,95 @@
+/**
+ * @file bench_parallel_for_each.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/parallel_for_each.hpp"
+#include "dd/partition.hpp"
+#include "dd/slice_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr auto size = std::int64_t{1} << 16;
+constexpr auto threads = std::size_t{4};
+
+/**
+ * @brief Work whose cost grows with the element, so that equal partitions are imbalanced.
+ */
+auto imbalanced_work(std::int64_t x) -> std::int64_t
+{
+  auto acc = x;
+  for (auto i = std::int64_t{0}; i < x / 512; ++i)
+  {
+    acc = acc * 31 + i;
+  }
+  return acc;
+}
+
+auto make_list() -> std::list<std::int64_t>
+{
+  auto data = std::list<std::int64_t>(static_cast<std::size_t>(size));
+  std::iota(data.begin(), data.end(), std::int64_t{0});
+  return data;
+}
+
+/**
+ * @brief Processes equal partitions of a slice, one thread per partition.
+ */
+void bm_static_partition(benchmark::State& state)
+{
+  auto data = make_list();
+  for (auto _ : state)
+  {
+    auto sliced = dd::ranges::slice_view(data, 0, size);
+    auto pieces = dd::ranges::partition(sliced, threads);
+    {
+      auto workers = std::vector<std::jthread>{};
+      for (auto& piece : pieces)
+      {
+        workers.emplace_back(
+          [&piece]
+          {
+            for (auto x : piece)
+            {
+              benchmark::DoNotOptimize(imbalanced_work(x));
+            }
+          });
+      }
+    }
+  }
+}
+
+/**
+ * @brief Processes a slice with parallel_for_each, stealing chunks from slow workers.
+ */
+void bm_parallel_for_each(benchmark::State& state)
+{
+  auto data = make_list();
+  for (auto _ : state)
+  {
+    auto sliced = dd::ranges::slice_view(data, 0, size);
+    dd::ranges::parallel_for_each(
+      sliced, [](std::int64_t x) { benchmark::DoNotOptimize(imbalanced_work(x)); },
+      threads, 256);
+  }
+}
+
+BENCHMARK(bm_static_partition)->UseRealTime();
+BENCHMARK(bm_parallel_for_each)->UseRealTime();
+
+} // namespace
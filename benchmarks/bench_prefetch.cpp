@@ -0,0 +1,116 @@
+/**
+ * @file bench_prefetch.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/slice_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <random>
+#include <ranges>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Number of elements of the lists, 64 MiB of nodes, larger than common last-level
+ * caches.
+ */
+constexpr auto size = std::int64_t{1} << 21;
+
+/**
+ * @brief Makes a list whose nodes are scattered in memory.
+ * @details The nodes are allocated in order and then spliced into a shuffled order, as
+ * after many insertions and removals, so that the hardware prefetcher cannot follow
+ * the list.
+ */
+auto make_scattered_list() -> std::list<std::int64_t>
+{
+  auto nodes = std::list<std::int64_t>(static_cast<std::size_t>(size));
+  auto order = std::vector<std::list<std::int64_t>::iterator>{};
+  order.reserve(static_cast<std::size_t>(size));
+  for (auto iter = nodes.begin(); iter != nodes.end(); ++iter)
+  {
+    order.push_back(iter);
+  }
+  std::ranges::shuffle(order, std::mt19937_64{42});
+
+  auto data = std::list<std::int64_t>{};
+  auto value = std::int64_t{0};
+  for (auto iter : order)
+  {
+    *iter = value++;
+    data.splice(data.end(), nodes, iter);
+  }
+  return data;
+}
+
+/**
+ * @brief Simulated work per element, enough to overlap with prefetches.
+ */
+auto work(std::uint64_t x) -> std::uint64_t
+{
+  for (auto i = 0; i < 8; ++i)
+  {
+    x = x * 6364136223846793005 + 1442695040888963407;
+  }
+  return x;
+}
+
+/**
+ * @brief Iterates a slice of a scattered list, doing work on each element.
+ * @tparam Policy The slice policy.
+ */
+template <typename Policy>
+void bm_iterate(benchmark::State& state)
+{
+  static auto const data = make_scattered_list();
+  for (auto _ : state)
+  {
+    auto sliced = data | dd::views::slice_with<Policy>(size / 4, size);
+    auto sum = std::uint64_t{0};
+    for (auto x : sliced)
+    {
+      sum += work(static_cast<std::uint64_t>(x));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * (size - size / 4));
+}
+
+/**
+ * @brief Locates the beginning of a slice far into a scattered list.
+ * @details The skip is a chain of dependent loads, which prefetching cannot shorten, so
+ * both policies are expected to perform the same.
+ * @tparam Policy The slice policy.
+ */
+template <typename Policy>
+void bm_skip(benchmark::State& state)
+{
+  static auto const data = make_scattered_list();
+  for (auto _ : state)
+  {
+    auto sliced = data | dd::views::slice_with<Policy>(size - 1, size);
+    benchmark::DoNotOptimize(*sliced.begin());
+  }
+  state.SetItemsProcessed(state.iterations() * (size - 1));
+}
+
+BENCHMARK(bm_iterate<dd::ranges::slice_policy>);
+BENCHMARK(bm_iterate<dd::ranges::prefetching_slice_policy<8>>);
+BENCHMARK(bm_iterate<dd::ranges::prefetching_slice_policy<16>>);
+BENCHMARK(bm_skip<dd::ranges::slice_policy>);
+BENCHMARK(bm_skip<dd::ranges::prefetching_slice_policy<8>>);
+
+} // namespace
@@ -0,0 +1,275 @@
+/**
+ * @file bench_slice_view.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/slice_view.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Number of repeated begin() calls in the repeated_begin benchmark.
+ */
+constexpr auto repeated_begin_calls = 16;
+
+/**
+ * @brief Sizes of the sliced ranges.
+ */
+constexpr auto small_size = std::int64_t{1} << 10;
+constexpr auto large_size = std::int64_t{1} << 16;
+
+/**
+ * @brief A sliced source backed by a container.
+ */
+template <typename Container>
+struct container_source
+{
+  explicit container_source(std::int64_t n)
+  {
+    for (auto i = 0; i < n; ++i)
+    {
+      data.push_back(i);
+    }
+  }
+
+  auto view() -> std::ranges::ref_view<Container> { return std::views::all(data); }
+
+  Container data;
+};
+
+struct vector_source : container_source<std::vector<int>>
+{
+  static constexpr auto name = "vector";
+  using container_source::container_source;
+};
+
+struct list_source : container_source<std::list<int>>
+{
+  static constexpr auto name = "list";
+  using container_source::container_source;
+};
+
+struct deque_source : container_source<std::deque<int>>
+{
+  static constexpr auto name = "deque";
+  using container_source::container_source;
+};
+
+/**
+ * @brief A filter_view, whose begin() is linear and whose iterators are bidirectional.
+ */
+struct filter_source : container_source<std::vector<int>>
+{
+  static constexpr auto name = "filter";
+  using container_source::container_source;
+
+  auto view() { return data | std::views::filter([](int x) { return x >= 0; }); }
+};
+
+/**
+ * @brief An iota_view, which is a random access range with no storage.
+ */
+struct iota_source
+{
+  static constexpr auto name = "iota";
+
+  explicit iota_source(std::int64_t n) : size{static_cast<int>(n)} {}
+
+  auto view() const { return std::views::iota(0, size); }
+
+  int size;
+};
+
+/**
+ * @brief Slices with dd::views::slice.
+ */
+struct slice_method
+{
+  static constexpr auto name = "slice";
+
+  template <typename V>
+  static auto apply(V& v, std::ptrdiff_t start, std::ptrdiff_t end)
+  {
+    return v | dd::views::slice(start, end);
+  }
+};
+
+/**
+ * @brief Slices with std::views::drop | std::views::take.
+ */
+struct drop_take_method
+{
+  static constexpr auto name = "drop_take";
+
+  template <typename V>
+  static auto apply(V& v, std::ptrdiff_t start, std::ptrdiff_t end)
+  {
+    return v | std::views::drop(start) | std::views::take(end - start);
+  }
+};
+
+/**
+ * @brief Slices with a std::ranges::subrange, locating both ends eagerly.
+ */
+struct subrange_method
+{
+  static constexpr auto name = "subrange";
+
+  template <typename V>
+  static auto apply(V& v, std::ptrdiff_t start, std::ptrdiff_t end)
+  {
+    auto first = std::ranges::next(std::ranges::begin(v), start, std::ranges::end(v));
+    auto last = std::ranges::next(first, end - start, std::ranges::end(v));
+    return std::ranges::subrange(first, last);
+  }
+};
+
+/**
+ * @brief Slices the middle half of the range.
+ */
+template <typename Source>
+struct bench_fixture
+{
+  explicit bench_fixture(benchmark::State const& state)
+      : source{state.range(0)}, start{state.range(0) / 4}, end{3 * state.range(0) / 4}
+  {
+  }
+
+  Source source;
+  std::ptrdiff_t start;
+  std::ptrdiff_t end;
+};
+
+/**
+ * @brief Constructs a slice and gets its begin and end.
+ */
+template <typename Source, typename Method>
+void bm_begin_end(benchmark::State& state)
+{
+  auto fixture = bench_fixture<Source>{state};
+  for (auto _ : state)
+  {
+    auto base = fixture.source.view();
+    auto slice = Method::apply(base, fixture.start, fixture.end);
+    auto first = std::ranges::begin(slice);
+    auto last = std::ranges::end(slice);
+    benchmark::DoNotOptimize(first);
+    benchmark::DoNotOptimize(last);
+  }
+}
+
+/**
+ * @brief Constructs a slice and sums all of its elements.
+ */
+template <typename Source, typename Method>
+void bm_iterate(benchmark::State& state)
+{
+  auto fixture = bench_fixture<Source>{state};
+  for (auto _ : state)
+  {
+    auto base = fixture.source.view();
+    auto slice = Method::apply(base, fixture.start, fixture.end);
+    auto sum = 0L;
+    for (auto x : slice)
+    {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * (fixture.end - fixture.start));
+}
+
+/**
+ * @brief Calls begin() and end() on the same slice many times.
+ *
+ * This is where caching pays off: after the first call, slice_view and drop_view return
+ * cached iterators, while a subrange pays for the whole search once up front.
+ */
+template <typename Source, typename Method>
+void bm_repeated_begin(benchmark::State& state)
+{
+  auto fixture = bench_fixture<Source>{state};
+  for (auto _ : state)
+  {
+    auto base = fixture.source.view();
+    auto slice = Method::apply(base, fixture.start, fixture.end);
+    for (auto i = 0; i < repeated_begin_calls; ++i)
+    {
+      auto first = std::ranges::begin(slice);
+      auto last = std::ranges::end(slice);
+      benchmark::DoNotOptimize(first);
+      benchmark::DoNotOptimize(last);
+    }
+  }
+}
+
+/**
+ * @brief Reports the size in bytes of the slice object.
+ */
+template <typename Source, typename Method>
+void bm_sizeof(benchmark::State& state)
+{
+  auto fixture = bench_fixture<Source>{state};
+  auto base = fixture.source.view();
+  using slice_type = decltype(Method::apply(base, fixture.start, fixture.end));
+  for (auto _ : state)
+  {
+    auto size = sizeof(slice_type);
+    benchmark::DoNotOptimize(size);
+  }
+  state.counters["sizeof"] = static_cast<double>(sizeof(slice_type));
+}
+
+template <typename Source, typename Method>
+auto register_benchmarks() -> bool
+{
+  auto const prefix = std::string{Source::name} + "/" + Method::name + "/";
+  benchmark::RegisterBenchmark(
+    (prefix + "begin_end").c_str(), bm_begin_end<Source, Method>)
+    ->Arg(small_size)
+    ->Arg(large_size);
+  benchmark::RegisterBenchmark((prefix + "iterate").c_str(), bm_iterate<Source, Method>)
+    ->Arg(small_size)
+    ->Arg(large_size);
+  benchmark::RegisterBenchmark(
+    (prefix + "repeated_begin").c_str(), bm_repeated_begin<Source, Method>)
+    ->Arg(small_size)
+    ->Arg(large_size);
+  benchmark::RegisterBenchmark((prefix + "sizeof").c_str(), bm_sizeof<Source, Method>)
+    ->Arg(small_size)
+    ->Iterations(1);
+  return true;
+}
+
+template <typename Source>
+auto register_source() -> bool
+{
+  return register_benchmarks<Source, slice_method>()
+      && register_benchmarks<Source, drop_take_method>()
+      && register_benchmarks<Source, subrange_method>();
+}
+
+[[maybe_unused]] auto const registered = register_source<vector_source>()
+                                      && register_source<list_source>()
+                                      && register_source<deque_source>()
+                                      && register_source<filter_source>()
+                                      && register_source<iota_source>();
+
+} // namespace
@@ -0,0 +1,166 @@
+# ==============================================================================
+#
+# Copyright (c) 2025 Devin DeLong
+# SPDX-License-Identifier: BSD-3-clause
+#
+# Licensed under the BSD 3-Clause License.
+# See the license file in the project root for full license information.
+#
+# ==============================================================================
+
+# Compiles the codegen sources, and reports their compile time, object size and
+# symbols. Then checks that every loop of the dd_codegen_slice_* functions in
+# hot_loop.cpp matches a loop of dd_codegen_raw_loop, and fails if one does not.
+#
+# Run by the slice_view_codegen target, with the variables CXX, CXX_FLAGS,
+# INCLUDE_DIR, SOURCE_DIR, OUTPUT_DIR, SIZE, NM and OBJDUMP. The report is also
+# written to ${OUTPUT_DIR}/slice_view_codegen.txt, so that it can be diffed.
+
+cmake_minimum_required (VERSION 3.23)
+
+set (REPORT "")
+
+function (report line)
+  message (STATUS "${line}")
+  set (REPORT "${REPORT}${line}\n" PARENT_SCOPE)
+endfunction ()
+
+# Compiles a source file to an object file, and reports the elapsed time.
+function (compile_timed name)
+  set (object "${OUTPUT_DIR}/${name}.o")
+  string (TIMESTAMP start "%s%f" UTC)
+  execute_process (
+    COMMAND ${CXX} ${CXX_FLAGS} -I "${INCLUDE_DIR}" -c "${SOURCE_DIR}/${name}.cpp"
+      -o "${object}"
+    RESULT_VARIABLE result
+    ERROR_VARIABLE errors
+  )
+  string (TIMESTAMP stop "%s%f" UTC)
+  if (NOT result EQUAL 0)
+    message (FATAL_ERROR "Compiling ${name}.cpp failed:\n${errors}")
+  endif ()
+  math (EXPR milliseconds "(${stop} - ${start}) / 1000")
+  report ("${name}: compile time ${milliseconds} ms")
+  set (${name}_OBJECT "${object}" PARENT_SCOPE)
+  set (REPORT "${REPORT}" PARENT_SCOPE)
+endfunction ()
+
+# Reports the section sizes, the number of defined symbols and the total length of
+# their mangled names, which grows with the number of distinct instantiations.
+function (report_object name object)
+  execute_process (
+    COMMAND "${SIZE}" "${object}"
+    OUTPUT_VARIABLE sizes
+    COMMAND_ERROR_IS_FATAL ANY
+  )
+  string (REGEX MATCH "\n *([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)" _ "${sizes}")
+  set (text "${CMAKE_MATCH_1}")
+  set (data "${CMAKE_MATCH_2}")
+  set (bss "${CMAKE_MATCH_3}")
+  report ("${name}: text ${text} B, data ${data} B, bss ${bss} B")
+
+  execute_process (
+    COMMAND "${NM}" --defined-only --format=posix "${object}"
+    OUTPUT_VARIABLE symbols
+    COMMAND_ERROR_IS_FATAL ANY
+  )
+  string (REGEX MATCHALL "[^\n]+" symbols "${symbols}")
+  list (LENGTH symbols count)
+  set (name_bytes 0)
+  foreach (symbol IN LISTS symbols)
+    string (REGEX MATCH "^[^ ]+" symbol_name "${symbol}")
+    string (LENGTH "${symbol_name}" length)
+    math (EXPR name_bytes "${name_bytes} + ${length}")
+  endforeach ()
+  report ("${name}: ${count} symbols, ${name_bytes} B of symbol names")
+  set (REPORT "${REPORT}" PARENT_SCOPE)
+endfunction ()
+
+# Disassembles a function, and returns its loops: the instructions from the target of
+# each backward branch up to the branch, as a sequence of mnemonics. Registers and
+# addresses are left out, so that only the instructions executed are compared.
+function (function_loops object function out_var)
+  execute_process (
+    COMMAND "${OBJDUMP}" -d --no-show-raw-insn "--disassemble=${function}" "${object}"
+    OUTPUT_VARIABLE disassembly
+    COMMAND_ERROR_IS_FATAL ANY
+  )
+  string (REGEX MATCHALL "[^\n]+" lines "${disassembly}")
+  set (addresses "")
+  set (mnemonics "")
+  set (loops "")
+  foreach (line IN LISTS lines)
+    if (NOT line MATCHES "^ *([0-9a-f]+):[ \t]+([a-z][a-z0-9.]*)[ \t]*(.*)$")
+      continue ()
+    endif ()
+    set (address "${CMAKE_MATCH_1}")
+    set (mnemonic "${CMAKE_MATCH_2}")
+    set (operands "${CMAKE_MATCH_3}")
+    # Alignment padding differs with the placement of the function, not its code.
+    if (mnemonic MATCHES "^(nop|cs$|data16$)")
+      continue ()
+    endif ()
+    math (EXPR address "0x${address}" OUTPUT_FORMAT DECIMAL)
+    list (APPEND addresses ${address})
+    list (APPEND mnemonics ${mnemonic})
+
+    # Branches within the function name their target as <function+offset>.
+    if (operands MATCHES "([0-9a-f]+) <${function}(\\+0x[0-9a-f]+)?>")
+      math (EXPR target "0x${CMAKE_MATCH_1}" OUTPUT_FORMAT DECIMAL)
+      if (target LESS_EQUAL address)
+        set (body "")
+        list (LENGTH addresses n)
+        math (EXPR last "${n} - 1")
+        foreach (i RANGE ${last})
+          list (GET addresses ${i} at)
+          if (at GREATER_EQUAL target)
+            list (GET mnemonics ${i} m)
+            string (APPEND body " ${m}")
+          endif ()
+        endforeach ()
+        string (STRIP "${body}" body)
+        list (APPEND loops "${body}")
+      endif ()
+    endif ()
+  endforeach ()
+  if (NOT mnemonics)
+    message (FATAL_ERROR "${function} was not found in ${object}.")
+  endif ()
+  set (${out_var} "${loops}" PARENT_SCOPE)
+endfunction ()
+
+compile_timed (instantiations)
+report_object (instantiations "${instantiations_OBJECT}")
+
+compile_timed (hot_loop)
+report_object (hot_loop "${hot_loop_OBJECT}")
+
+function_loops ("${hot_loop_OBJECT}" dd_codegen_raw_loop raw_loops)
+if (NOT raw_loops)
+  message (FATAL_ERROR "No loop was found in dd_codegen_raw_loop.")
+endif ()
+
+set (mismatches 0)
+foreach (function IN ITEMS dd_codegen_slice_adaptor dd_codegen_slice_view)
+  function_loops ("${hot_loop_OBJECT}" ${function} loops)
+  list (LENGTH loops count)
+  set (matched 0)
+  foreach (loop IN LISTS loops)
+    if (loop IN_LIST raw_loops)
+      math (EXPR matched "${matched} + 1")
+    else ()
+      report ("${function}: loop differs from the raw pointer loops: ${loop}")
+    endif ()
+  endforeach ()
+  report ("${function}: ${matched} of ${count} loops match the raw pointer loop")
+  if (count EQUAL 0 OR NOT matched EQUAL count)
+    math (EXPR mismatches "${mismatches} + 1")
+  endif ()
+endforeach ()
+
+file (WRITE "${OUTPUT_DIR}/slice_view_codegen.txt" "${REPORT}")
+
+if (mismatches GREATER 0)
+  string (REPLACE ";" "\n  " raw_loops "${raw_loops}")
+  message (FATAL_ERROR "Slice loops differ from the raw pointer loops:\n  ${raw_loops}")
+endif ()
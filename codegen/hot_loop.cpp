@@ -0,0 +1,63 @@
+/**
+ * @file hot_loop.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+// Hot loops compared by codegen_report.cmake. Every loop of a dd_codegen_slice_*
+// function must match a loop of dd_codegen_raw_loop, instruction for instruction.
+// The functions have C linkage so that their symbols are easy to find.
+
+#include "dd/slice_view.hpp"
+
+#include <cstddef>
+#include <vector>
+
+extern "C"
+{
+
+/**
+ * @brief The reference: sums the elements between two pointers.
+ */
+auto dd_codegen_raw_loop(int const* first, int const* last) -> long
+{
+  auto sum = 0L;
+  for (; first != last; ++first)
+  {
+    sum += *first;
+  }
+  return sum;
+}
+
+/**
+ * @brief Sums a slice of a vector taken by the slice adaptor, i.e. a std::span.
+ */
+auto dd_codegen_slice_adaptor(
+  std::vector<int> const& v, std::ptrdiff_t a, std::ptrdiff_t b) -> long
+{
+  auto sum = 0L;
+  for (const auto x : v | dd::views::slice(a, b))
+  {
+    sum += x;
+  }
+  return sum;
+}
+
+/**
+ * @brief Sums a slice_view of a vector, iterated with the iterators of the vector.
+ */
+auto dd_codegen_slice_view(
+  std::vector<int> const& v, std::ptrdiff_t a, std::ptrdiff_t b) -> long
+{
+  auto sum = 0L;
+  for (const auto x : dd::ranges::slice_view(v, a, b))
+  {
+    sum += x;
+  }
+  return sum;
+}
+}
@@ -0,0 +1,88 @@
+/**
+ * @file instantiations.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+// A representative set of slice_view instantiations, whose object size, symbol count
+// and compile time are reported by codegen_report.cmake. Each function iterates its
+// slice and asks for its size where it has one, so that the members used in practice
+// are instantiated.
+
+#include "dd/slice_view.hpp"
+
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+template <std::ranges::input_range R>
+auto consume(R&& r) -> long
+{
+  auto sum = 0L;
+  for (auto&& x : r)
+  {
+    sum += x;
+  }
+  if constexpr (std::ranges::sized_range<R>)
+  {
+    sum += static_cast<long>(std::ranges::size(r));
+  }
+  return sum;
+}
+
+auto is_even(int x) -> bool { return x % 2 == 0; }
+} // namespace
+
+auto slice_vector(std::vector<int> const& v) -> long
+{
+  return consume(dd::ranges::slice_view(v, 1, -1));
+}
+
+auto slice_deque(std::deque<int> const& d) -> long
+{
+  return consume(d | dd::views::slice(1, -1));
+}
+
+auto slice_list(std::list<int> const& l) -> long
+{
+  return consume(l | dd::views::slice(1, -1));
+}
+
+auto slice_forward_list(std::forward_list<int> const& l) -> long
+{
+  return consume(l | dd::views::slice(2, 10));
+}
+
+auto lazy_slice_filter(std::vector<int> const& v) -> long
+{
+  return consume(v | std::views::filter(is_even) | dd::views::lazy_slice(2, 10));
+}
+
+auto strided_slice_list(std::list<int> const& l) -> long
+{
+  return consume(l | dd::views::slice(0, 100, 3));
+}
+
+auto slice_of_slice_list(std::list<int> const& l) -> long
+{
+  return consume(l | dd::views::slice(1, 50) | dd::views::slice(2, 10));
+}
+
+auto slice_iota() -> long
+{
+  return consume(dd::ranges::slice_view(std::views::iota(0, 100), 10, 20));
+}
+
+auto slice_istream(std::istream& in) -> long
+{
+  return consume(std::views::istream<int>(in) | dd::views::slice(1, 4));
+}
@@ -8,6 +8,7 @@
  * @author Devin DeLong
  */
 
+#include "dd/compact_slice_view.hpp"
 #include "dd/slice_view.hpp"
 
 #include <iostream>
@@ -65,5 +66,10 @@ int main()
   std::cout << "\nsizeof cached slice_view: " << sizeof(slice_cached) << "\n";
   std::println("size: {}", slice1.size());
 
+  // The compact layout stores either the indices or the iterators, and narrow indices.
+  const auto slice_compact = dd::ranges::compact_slice_view(lst, 2, 5);
+  std::println("sizeof compact slice_view: {}", sizeof(slice_compact));
+  std::println("size: {}", slice_compact.size());
+
   return 0;
 }
@@ -0,0 +1,89 @@
+/**
+ * @file advance_by.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include <concepts>
+#include <iterator>
+#include <utility>
+
+namespace dd::ranges
+{
+
+namespace detail::advance_by_impl
+{
+// Blocks unqualified lookup, so that only ADL finds customizations.
+void advance_by() = delete;
+
+template <typename I, typename S>
+concept has_member_advance_by =
+  requires(I& iter, std::iter_difference_t<I> n, S bound) {
+    { iter.advance_by(n, std::move(bound)) } -> std::same_as<std::iter_difference_t<I>>;
+  };
+
+template <typename I, typename S>
+concept has_adl_advance_by =
+  requires(I& iter, std::iter_difference_t<I> n, S bound) {
+    { advance_by(iter, n, std::move(bound)) } -> std::same_as<std::iter_difference_t<I>>;
+  };
+
+/**
+ * @brief Function object type of dd::ranges::advance_by.
+ */
+struct fn
+{
+  /**
+   * @brief Advances an iterator by n elements, bounded by a sentinel.
+   * @details Dispatches to, in order:
+   *  - the member iter.advance_by(n, bound),
+   *  - an advance_by(iter, n, bound) found by argument-dependent lookup,
+   *  - std::ranges::advance(iter, n, bound).
+   * A customization must behave like std::ranges::advance, but may skip elements
+   * without visiting them, e.g. by seeking whole blocks of a stream.
+   * @param iter The iterator to advance.
+   * @param n Number of elements to advance by. May be negative for bidirectional
+   * iterators.
+   * @param bound Bound of the iterator.
+   * @return The number of elements that could not be advanced by, i.e. n minus the
+   * distance that iter was advanced.
+   */
+  template <std::input_or_output_iterator I, std::sentinel_for<I> S>
+  constexpr auto operator()(I& iter, std::iter_difference_t<I> n, S bound) const
+    -> std::iter_difference_t<I>
+  {
+    if constexpr (has_member_advance_by<I, S>)
+    {
+      return iter.advance_by(n, std::move(bound));
+    }
+    else if constexpr (has_adl_advance_by<I, S>)
+    {
+      return advance_by(iter, n, std::move(bound));
+    }
+    else
+    {
+      return std::ranges::advance(iter, n, std::move(bound));
+    }
+  }
+};
+} // namespace detail::advance_by_impl
+
+inline namespace cpo
+{
+/**
+ * @brief Customization point for advancing an iterator by n elements, bounded by a
+ * sentinel.
+ * @details Iterators opt in by providing a member advance_by(n, bound), or a free
+ * function advance_by(iter, n, bound) in the namespace of the iterator. slice_view
+ * locates its starting and ending positions through it.
+ */
+inline constexpr auto advance_by = detail::advance_by_impl::fn{};
+} // namespace cpo
+
+} // namespace dd::ranges
@@ -0,0 +1,123 @@
+/**
+ * @file aligned_split.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief The head, body and tail of a contiguous slice, see aligned_split().
+ * @tparam T The element type.
+ * @tparam Alignment The alignment of the body, in bytes.
+ */
+template <typename T, std::size_t Alignment>
+struct aligned_parts
+{
+  /**
+   * @brief Number of elements in one aligned block of the body.
+   */
+  static constexpr auto lanes = Alignment / sizeof(T);
+
+  /**
+   * @brief Unaligned prologue, with fewer than lanes elements.
+   */
+  std::span<T> head;
+
+  /**
+   * @brief Aligned body, whose size is a multiple of lanes.
+   */
+  std::span<T> body;
+
+  /**
+   * @brief Epilogue after the body, with fewer than lanes elements.
+   */
+  std::span<T> tail;
+
+  /**
+   * @brief Gets the data of the body, with its alignment known to the compiler.
+   * @details The body must not be empty.
+   * @return Pointer to the first element of the body, passed through std::assume_aligned.
+   */
+  [[nodiscard]] auto body_data() const noexcept -> T*
+  {
+    assert(!body.empty());
+    return std::assume_aligned<Alignment>(body.data());
+  }
+};
+
+/**
+ * @brief Splits a contiguous slice into an unaligned head, an aligned body and a tail.
+ * @details The body starts at the first element aligned to Alignment bytes, and holds
+ * as many whole blocks of Alignment bytes as fit in the slice. SIMD kernels can process
+ * the body with aligned loads, and the head and tail with scalar code. If no element of
+ * the slice is aligned (e.g. the slice is shorter than the head), the whole slice is the
+ * head.
+ * @tparam Alignment The alignment of the body in bytes, e.g. the SIMD register width.
+ * @param slice The contiguous slice.
+ * @return The head, body and tail of the slice.
+ */
+template <std::size_t Alignment, typename T, std::size_t Extent>
+[[nodiscard]] auto aligned_split(std::span<T, Extent> slice)
+  -> aligned_parts<T, Alignment>
+{
+  static_assert(std::has_single_bit(Alignment), "The alignment must be a power of two.");
+  static_assert(
+    Alignment % sizeof(T) == 0, "The alignment must be a multiple of the element size.");
+
+  constexpr auto lanes = aligned_parts<T, Alignment>::lanes;
+  const auto address = reinterpret_cast<std::uintptr_t>(slice.data());
+  const auto misalignment = address % Alignment;
+
+  auto head_size = slice.size();
+  if (misalignment % sizeof(T) == 0)
+  {
+    const auto to_aligned = (Alignment - misalignment) % Alignment / sizeof(T);
+    head_size = std::min(to_aligned, slice.size());
+  }
+  const auto body_size = (slice.size() - head_size) / lanes * lanes;
+
+  auto parts = std::span<T>(slice);
+  return {
+    .head = parts.first(head_size),
+    .body = parts.subspan(head_size, body_size),
+    .tail = parts.subspan(head_size + body_size),
+  };
+}
+
+/**
+ * @brief Splits a contiguous slice into an unaligned head, an aligned body and a tail.
+ * @details See aligned_split(std::span). This overload accepts contiguous slices that the
+ * slice adaptor did not collapse into a std::span, e.g. slice_views over contiguous
+ * ranges.
+ * @tparam Alignment The alignment of the body in bytes, e.g. the SIMD register width.
+ * @param slice The contiguous slice.
+ * @return The head, body and tail of the slice.
+ */
+template <std::size_t Alignment, std::ranges::contiguous_range R>
+  requires std::ranges::sized_range<R> && std::ranges::borrowed_range<R>
+[[nodiscard]] auto aligned_split(R&& slice)
+{
+  using element_type = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+  return aligned_split<Alignment>(std::span<element_type>(
+    std::ranges::data(slice), static_cast<std::size_t>(std::ranges::size(slice))));
+}
+
+} // namespace dd::ranges
@@ -36,9 +36,17 @@ concept cacheable_range =
  *
  * The resulting type is a non_propagating_cache that does not propagate it's state when
  * copied or moved.
+ *
+ * @tparam Tag Either sequential_tag or concurrent_tag, see non_propagating_cache.
+ */
+template <std::ranges::range R, typename Tag = sequential_tag>
+using cached_iterator_t = non_propagating_cache<std::ranges::iterator_t<R>, Tag>;
+
+/**
+ * @brief Cached iterator type that can be filled and read concurrently.
  */
 template <std::ranges::range R>
-using cached_iterator_t = non_propagating_cache<std::ranges::iterator_t<R>>;
+using concurrent_cached_iterator_t = cached_iterator_t<R, concurrent_tag>;
 
 /**
  * @brief Conditionally cached iterator type.
@@ -48,8 +56,11 @@ using cached_iterator_t = non_propagating_cache<std::ranges::iterator_t<R>>;
  *
  * This is intended to be used in conjunction with [[no_unique_address]].
  */
-template <std::ranges::range R, is_empty E = DD_UNIQUE_EMPTY_TYPE>
+template <
+  std::ranges::range R,
+  is_empty E = DD_UNIQUE_EMPTY_TYPE,
+  typename Tag = sequential_tag>
 using maybe_cached_iterator_t =
-  maybe_present_t<cacheable_range<R>, cached_iterator_t<R>, E>;
+  maybe_present_t<cacheable_range<R>, cached_iterator_t<R, Tag>, E>;
 
 } // namespace dd::ranges
@@ -0,0 +1,262 @@
+/**
+ * @file checkpoint_index.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/slice_view.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief A sparse index of iterators into a forward range.
+ *
+ * The index records an iterator every interval elements, so that any position of the
+ * range is located in at most interval increments from the nearest checkpoint. The
+ * checkpoints are recorded lazily, while locating positions past the last checkpoint.
+ *
+ * The index is intended for repeated slicing of a long-lived range, through the
+ * slice_view constructor that takes a slice locator:
+ *
+ * @code
+ * auto index = dd::ranges::checkpoint_index(lst, 256);
+ * auto page = dd::ranges::slice_view(index, 1000, 1100);
+ * @endcode
+ *
+ * Slices located by the index refer to the base held by the index, which must outlive
+ * them. The checkpoints are invalidated by any change of the base range that invalidates
+ * its iterators or shifts its elements, and must be dropped with invalidate() or
+ * invalidate_from() after such a change.
+ *
+ * @tparam R The base view.
+ */
+template <std::ranges::forward_range R>
+  requires std::ranges::view<R>
+class checkpoint_index
+{
+public:
+  /**
+   * @brief Alias for the base view.
+   */
+  using base_type = R;
+
+  /**
+   * @brief Alias for the iterator type of the base view.
+   */
+  using iterator = std::ranges::iterator_t<R>;
+
+  /**
+   * @brief Alias for the ranges difference type.
+   */
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  /**
+   * @brief Constructor.
+   * @param base The base view.
+   * @param interval Number of elements between consecutive checkpoints.
+   */
+  constexpr explicit checkpoint_index(R base, difference_type interval = 64)
+      : base_{std::move(base)}, interval_{interval}
+  {
+    assert(interval > 0);
+  }
+
+  /**
+   * @brief Gets a copy of the base view.
+   * @return A copy of the base view.
+   */
+  [[nodiscard]] constexpr auto base() const -> R
+    requires std::copy_constructible<R>
+  {
+    return base_;
+  }
+
+  /**
+   * @brief Gets a view of the base held by the index, for slices located by it.
+   * @details The checkpoints are iterators of this base, so slices seeded with them
+   * must refer to it rather than to a copy, which would not be the same range for
+   * views that are not borrowed (e.g. a filter_view or an owning_view).
+   * @return A ref_view of the base view.
+   */
+  [[nodiscard]] constexpr auto slice_base() noexcept -> std::ranges::ref_view<R>
+  {
+    return std::ranges::ref_view<R>(base_);
+  }
+
+  /**
+   * @brief Gets the number of elements between consecutive checkpoints.
+   * @return The checkpoint interval.
+   */
+  [[nodiscard]] constexpr auto interval() const noexcept -> difference_type
+  {
+    return interval_;
+  }
+
+  /**
+   * @brief Gets the number of recorded checkpoints.
+   * @return The checkpoint count.
+   */
+  [[nodiscard]] constexpr auto checkpoint_count() const noexcept -> std::size_t
+  {
+    return checkpoints_.size();
+  }
+
+  /**
+   * @brief Gets the number of elements of the base.
+   * @details Records the checkpoints up to the end of the base, if they were not yet.
+   * @return Size of the base.
+   */
+  [[nodiscard]] constexpr auto size() -> difference_type
+  {
+    extend_to(std::numeric_limits<difference_type>::max());
+    return *size_;
+  }
+
+  /**
+   * @brief Locates the iterator at an index.
+   * @param index Index from the beginning of the base.
+   * @return Iterator at the index, clamped to the end of the base.
+   */
+  [[nodiscard]] constexpr auto locate(difference_type index) -> iterator
+  {
+    assert(index >= 0);
+    extend_to(index);
+
+    const auto checkpoint = std::min(
+      index / interval_, static_cast<difference_type>(checkpoints_.size()) - 1);
+    return std::ranges::next(
+      checkpoints_[static_cast<std::size_t>(checkpoint)], index - checkpoint * interval_,
+      std::ranges::end(base_));
+  }
+
+  /**
+   * @brief Locates the slice [start, end) of the base.
+   * @details Negative indices are counted from the end of the base, which records all
+   * checkpoints once. The ending iterator is advanced from the starting iterator when
+   * that is closer than the nearest checkpoint.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   * @return The indices and iterators of the slice.
+   */
+  [[nodiscard]] constexpr auto locate_slice(difference_type start, difference_type end)
+    -> located_slice<iterator, difference_type>
+  {
+    if (start < 0)
+    {
+      start = std::max(size() + start, difference_type{0});
+    }
+    if (end == std::numeric_limits<difference_type>::max())
+    {
+      end = size();
+    }
+    else if (end < 0)
+    {
+      end = std::max(size() + end, difference_type{0});
+    }
+    end = std::max(end, start);
+
+    auto first = locate(start);
+    auto last = end - start < end % interval_
+                  ? std::ranges::next(first, end - start, std::ranges::end(base_))
+                  : locate(end);
+    return {start, end, std::move(first), std::move(last)};
+  }
+
+  /**
+   * @brief Drops all checkpoints.
+   */
+  constexpr auto invalidate() noexcept -> void
+  {
+    checkpoints_.clear();
+    size_.reset();
+  }
+
+  /**
+   * @brief Drops the checkpoints at and after an index.
+   * @details Use this after inserting or erasing elements at the index, when the
+   * iterators before it remain valid (e.g. for std::list).
+   * @param index The first index whose position changed.
+   */
+  constexpr auto invalidate_from(difference_type index) -> void
+  {
+    assert(index >= 0);
+    // The first checkpoint is the beginning of the base, which may have changed too.
+    const auto kept = index == 0 ? 0 : (index - 1) / interval_ + 1;
+    if (kept < static_cast<difference_type>(checkpoints_.size()))
+    {
+      checkpoints_.resize(static_cast<std::size_t>(kept));
+    }
+    size_.reset();
+  }
+
+private:
+  /**
+   * @brief Records the checkpoints up to the one preceding an index.
+   * @param index Index from the beginning of the base.
+   */
+  constexpr auto extend_to(difference_type index) -> void
+  {
+    if (checkpoints_.empty())
+    {
+      checkpoints_.push_back(std::ranges::begin(base_));
+    }
+
+    const auto target = index / interval_;
+    const auto last = std::ranges::end(base_);
+    while (!size_ && static_cast<difference_type>(checkpoints_.size()) - 1 < target)
+    {
+      const auto position =
+        (static_cast<difference_type>(checkpoints_.size()) - 1) * interval_;
+      auto iter = checkpoints_.back();
+      const auto remaining = std::ranges::advance(iter, interval_, last);
+      if (remaining > 0)
+      {
+        size_ = position + interval_ - remaining;
+        break;
+      }
+
+      checkpoints_.push_back(std::move(iter));
+      if (checkpoints_.back() == last)
+      {
+        size_ = position + interval_;
+      }
+    }
+  }
+
+  R base_{};
+  difference_type interval_{64};
+  std::vector<iterator> checkpoints_{};
+  std::optional<difference_type> size_{};
+};
+
+/**
+ * @brief Deduction guide for checkpoint_index.
+ * @details Wraps the input range type in std::views::all_t.
+ */
+template <typename R>
+checkpoint_index(R&&, std::ranges::range_difference_t<R>)
+  -> checkpoint_index<std::views::all_t<R>>;
+
+/**
+ * @brief Deduction guide for checkpoint_index.
+ * @details Wraps the input range type in std::views::all_t.
+ */
+template <typename R>
+checkpoint_index(R&&) -> checkpoint_index<std::views::all_t<R>>;
+
+} // namespace dd::ranges
@@ -0,0 +1,332 @@
+/**
+ * @file compact_slice_view.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/slice_view.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief A slice of a borrowed forward range with a compact memory layout.
+ *
+ * A slice_view stores its base, both indices and both cached iterators, each cache with
+ * its own engaged flag. This view stores either the indices or the iterators in one
+ * storage slot: the indices are dropped once both ends of the slice are located, on the
+ * first call of begin(), end() or size() (or on construction, when the iterators are
+ * given). The indices are stored as Index, e.g. std::uint32_t, which also holds the
+ * length of the slice once it is known. This suits large numbers of slices that are
+ * kept in index structures.
+ *
+ * The cost of the layout is that both ends are located together, so begin() also walks
+ * to the ending index, and that the indices of a located slice are no longer available.
+ * Since the iterators outlive the view, the base must be a borrowed range, and copies
+ * keep the located iterators. Like the sequential caches of slice_view, locating is not
+ * synchronized.
+ *
+ * Negative indices are counted from the end of the base, see from_end, and require a
+ * signed Index. The maximum value of Index denotes the end of the base.
+ * @tparam R The base view.
+ * @tparam Index The type used to store the indices and the length of the slice.
+ */
+template <std::ranges::forward_range R, std::integral Index = std::uint32_t>
+  requires std::ranges::view<R> && std::ranges::borrowed_range<R> &&
+           std::is_trivially_copyable_v<std::ranges::iterator_t<R>>
+class compact_slice_view
+    : public std::ranges::view_interface<compact_slice_view<R, Index>>
+{
+  using iterator_type = std::ranges::iterator_t<R>;
+
+  struct indices
+  {
+    Index start;
+    Index end;
+  };
+
+  struct iterators
+  {
+    iterator_type first;
+    iterator_type last;
+  };
+
+  /**
+   * @brief Storage slot holding either the indices or the located iterators.
+   */
+  union slot
+  {
+    indices index{};
+    iterators iter;
+  };
+
+  /**
+   * @brief Which member of the storage slot is active, and whether the length is known.
+   */
+  enum class state : unsigned char
+  {
+    indices,
+    iterators,
+    iterators_and_length,
+  };
+
+public:
+  /**
+   * @brief Alias for the ranges difference type.
+   */
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  /**
+   * @brief Alias for the type used to store the indices.
+   */
+  using index_type = Index;
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  constexpr compact_slice_view()
+    requires std::default_initializable<R>
+  = default;
+
+  /**
+   * @brief Constructor.
+   * @param base The base view.
+   * @param start Starting index of the slice. Must be representable as Index.
+   * @param end Ending index of the slice. Must be representable as Index, or from_end(0).
+   */
+  constexpr compact_slice_view(R base, difference_type start, difference_type end)
+      : base_{std::move(base)}
+  {
+    assert(start < 0 || end < 0 || end >= start);
+    slot_.index = {narrow(start), narrow(end)};
+  }
+
+  /**
+   * @brief Constructor with pre-located iterators.
+   * @details The indices are dropped right away, and only used to find the length of
+   * the slice if the base is sized.
+   * @param base The base view.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   * @param first Iterator of the base at the starting index.
+   * @param last Iterator of the base at the ending index.
+   */
+  constexpr compact_slice_view(
+    R base, difference_type start, difference_type end, iterator_type first,
+    iterator_type last)
+      : base_{std::move(base)}
+  {
+    assert(start < 0 || end < 0 || end >= start);
+    std::construct_at(&slot_.iter, iterators{std::move(first), std::move(last)});
+    state_ = state::iterators;
+    if constexpr (std::ranges::sized_range<R>)
+    {
+      const auto [start_pos, end_pos] = resolve(start, end);
+      record_length(end_pos - start_pos);
+    }
+  }
+
+  /**
+   * @brief Gets a copy of the base view.
+   * @return A copy of the base view.
+   */
+  [[nodiscard]] constexpr auto base() const -> R { return base_; }
+
+  /**
+   * @brief Checks if the ends of the slice are located and the indices dropped.
+   * @return True if the storage slot holds the iterators.
+   */
+  [[nodiscard]] constexpr auto is_located() const noexcept -> bool
+  {
+    return state_ != state::indices;
+  }
+
+  /**
+   * @brief Gets an iterator to the beginning of the slice.
+   * @details Locates both ends of the slice, if they were not yet.
+   * @return Iterator of the base at the starting index.
+   */
+  [[nodiscard]] constexpr auto begin() const -> iterator_type { return locate().first; }
+
+  /**
+   * @brief Gets an iterator to the end of the slice.
+   * @details Locates both ends of the slice, if they were not yet.
+   * @return Iterator of the base at the ending index.
+   */
+  [[nodiscard]] constexpr auto end() const -> iterator_type { return locate().last; }
+
+  /**
+   * @brief Gets the size of the slice.
+   * @details For sized bases, the size is computed from the indices while they are
+   * stored. Otherwise, the length is found when locating the ends, or counted once
+   * for slices constructed with pre-located iterators.
+   * @return Size of the slice.
+   */
+  [[nodiscard]] constexpr auto size() const -> std::make_unsigned_t<difference_type>
+  {
+    if constexpr (std::ranges::sized_range<R>)
+    {
+      if (state_ == state::indices)
+      {
+        const auto [start, end] = resolve_stored();
+        return static_cast<std::make_unsigned_t<difference_type>>(end - start);
+      }
+    }
+    auto const& located = locate();
+    if (state_ != state::iterators_and_length)
+    {
+      record_length(std::ranges::distance(located.first, located.last));
+    }
+    return static_cast<std::make_unsigned_t<difference_type>>(length_);
+  }
+
+private:
+  /**
+   * @brief Narrows an index to the storage type.
+   * @param index The index of the slice.
+   * @return The stored index. from_end(0) is stored as the maximum value of Index.
+   */
+  [[nodiscard]] static constexpr auto narrow(difference_type index) -> Index
+  {
+    if (index == std::numeric_limits<difference_type>::max())
+    {
+      return std::numeric_limits<Index>::max();
+    }
+    assert(std::in_range<Index>(index) && index != std::numeric_limits<Index>::max());
+    return static_cast<Index>(index);
+  }
+
+  /**
+   * @brief Widens a stored index to the difference type.
+   * @param index The stored index.
+   * @return The index of the slice.
+   */
+  [[nodiscard]] static constexpr auto widen(Index index) -> difference_type
+  {
+    if (index == std::numeric_limits<Index>::max())
+    {
+      return std::numeric_limits<difference_type>::max();
+    }
+    return static_cast<difference_type>(index);
+  }
+
+  /**
+   * @brief Resolves the indices against the size of the base.
+   * @details The base is only measured if an index is negative or the base is sized.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   * @return The non-negative starting and ending positions, with end >= start. They are
+   * clamped to the size of the base, if it was measured.
+   */
+  [[nodiscard]] constexpr auto resolve(difference_type start, difference_type end) const
+    -> std::pair<difference_type, difference_type>
+  {
+    if (std::ranges::sized_range<R> || start < 0 || end < 0)
+    {
+      const auto size = [&]
+      {
+        if constexpr (std::ranges::sized_range<R>)
+        {
+          return static_cast<difference_type>(std::ranges::ssize(base_));
+        }
+        else
+        {
+          return std::ranges::distance(base_);
+        }
+      }();
+      start = std::clamp(start < 0 ? size + start : start, difference_type{0}, size);
+      end = std::clamp(end < 0 ? size + end : end, difference_type{0}, size);
+    }
+    return {start, std::max(start, end)};
+  }
+
+  /**
+   * @brief Resolves the stored indices against the size of the base, see resolve().
+   * @return The non-negative starting and ending positions.
+   */
+  [[nodiscard]] constexpr auto resolve_stored() const
+    -> std::pair<difference_type, difference_type>
+  {
+    return resolve(widen(slot_.index.start), widen(slot_.index.end));
+  }
+
+  /**
+   * @brief Stores the length of the slice.
+   * @param length The length of the slice.
+   */
+  constexpr auto record_length(difference_type length) const -> void
+  {
+    assert(std::in_range<Index>(length));
+    length_ = static_cast<Index>(length);
+    state_ = state::iterators_and_length;
+  }
+
+  /**
+   * @brief Locates both ends of the slice, replacing the indices by the iterators.
+   * @details The end is advanced from the beginning of the slice, so locating costs
+   * the ending index in increments, and also yields the length of the slice.
+   * @return The located iterators.
+   */
+  constexpr auto locate() const -> iterators const&
+  {
+    if (state_ == state::indices)
+    {
+      const auto [start, end] = resolve_stored();
+      auto first = std::ranges::begin(base_);
+      const auto bound = std::ranges::end(base_);
+      detail::counted_advance(first, start, bound);
+      auto last = first;
+      const auto length = end == std::numeric_limits<difference_type>::max()
+                            ? detail::counted_advance(last, bound)
+                            : detail::counted_advance(last, end - start, bound);
+      std::construct_at(&slot_.iter, iterators{first, last});
+      record_length(length);
+    }
+    return slot_.iter;
+  }
+
+  R base_{};
+  mutable slot slot_{};
+  mutable Index length_{0};
+  mutable state state_{state::indices};
+};
+
+/**
+ * @brief Deduction guide for compact_slice_view.
+ * @details Wraps the input range type in std::views::all_t, and stores the indices as
+ * std::uint32_t.
+ */
+template <typename R>
+compact_slice_view(
+  R&&, std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>)
+  -> compact_slice_view<std::views::all_t<R>>;
+
+} // namespace dd::ranges
+
+namespace std::ranges
+{
+/**
+ * @brief A compact_slice_view is a borrowed range, since its iterators are iterators of
+ * its borrowed base.
+ */
+template <typename R, typename Index>
+inline constexpr bool enable_borrowed_range<dd::ranges::compact_slice_view<R, Index>> =
+  true;
+} // namespace std::ranges
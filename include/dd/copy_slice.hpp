@@ -0,0 +1,144 @@
+/**
+ * @file copy_slice.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/to.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace dd::ranges
+{
+
+namespace detail
+{
+/**
+ * @brief Concept for sized contiguous ranges of trivially copyable elements.
+ */
+template <typename R>
+concept trivially_copyable_contiguous =
+  std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+  std::is_trivially_copyable_v<std::ranges::range_value_t<R>>;
+
+/**
+ * @brief Concept for copies from a range to an output iterator that lower to memcpy.
+ * @details The range must be trivially_copyable_contiguous, and the output a contiguous
+ * iterator to non-const elements of the same type.
+ */
+template <typename R, typename O>
+concept memcpy_copyable =
+  trivially_copyable_contiguous<R> && std::contiguous_iterator<O> &&
+  std::same_as<std::iter_value_t<O>, std::ranges::range_value_t<R>> &&
+  std::indirectly_copyable<std::ranges::iterator_t<R>, O>;
+
+/**
+ * @brief Concept for containers constructible from a pair of pointers to elements.
+ */
+template <typename C, typename T>
+concept pointer_constructible = std::constructible_from<C, T const*, T const*>;
+} // namespace detail
+
+/**
+ * @brief Copies the elements of a range, such as a slice, to an output iterator.
+ * @details Dispatches on the range and the output:
+ *  - Sized contiguous ranges of trivially copyable elements, copied to a contiguous
+ *    iterator of the same element type, are copied by a single std::memcpy. As for
+ *    std::memcpy, the source and destination must not overlap.
+ *  - Other sized random access ranges are copied by std::ranges::copy_n with the known
+ *    count, which does not compare iterators on every element.
+ *  - Other ranges are copied by std::ranges::copy.
+ * Slices of contiguous ranges are contiguous, so e.g. a slice_view of a std::vector
+ * takes the first path.
+ * @param r The range to copy.
+ * @param out The beginning of the destination.
+ * @return The end of the copied range and the end of the destination.
+ */
+template <std::ranges::input_range R, std::weakly_incrementable O>
+  requires std::indirectly_copyable<std::ranges::iterator_t<R>, O>
+constexpr auto copy_slice(R&& r, O out)
+  -> std::ranges::copy_result<std::ranges::borrowed_iterator_t<R>, O>
+{
+  if constexpr (detail::memcpy_copyable<R, O>)
+  {
+    const auto count = std::ranges::distance(r);
+    auto first = std::ranges::begin(r);
+    if !consteval
+    {
+      if (count > 0)
+      {
+        std::memcpy(
+          std::to_address(out), std::ranges::data(r),
+          static_cast<std::size_t>(count) * sizeof(std::ranges::range_value_t<R>));
+      }
+      return {first + count, out + count};
+    }
+    return std::ranges::copy_n(std::move(first), count, std::move(out));
+  }
+  else if constexpr (
+    std::ranges::random_access_range<R> && std::ranges::sized_range<R>)
+  {
+    return std::ranges::copy_n(
+      std::ranges::begin(r), std::ranges::distance(r), std::move(out));
+  }
+  else
+  {
+    return std::ranges::copy(std::forward<R>(r), std::move(out));
+  }
+}
+
+/**
+ * @brief Materializes a range, such as a slice, into a container.
+ * @details Sized contiguous ranges of trivially copyable elements are copied by
+ * constructing the container from pointers to their elements, which standard
+ * containers lower to a single memcpy into their storage. Other ranges are
+ * materialized by dd::ranges::to, which reserves their size or reserve_hint.
+ * @tparam C The container type.
+ * @param r The range to materialize.
+ * @return The container.
+ */
+template <typename C, std::ranges::input_range R>
+  requires(!std::ranges::view<C>)
+[[nodiscard]] constexpr auto slice_to(R&& r) -> C
+{
+  using value_type = std::ranges::range_value_t<R>;
+  if constexpr (
+    detail::trivially_copyable_contiguous<R> &&
+    detail::pointer_constructible<C, value_type>)
+  {
+    value_type const* first = std::ranges::data(r);
+    return C(first, first + std::ranges::size(r));
+  }
+  else
+  {
+    return dd::ranges::to<C>(std::forward<R>(r));
+  }
+}
+
+/**
+ * @brief Materializes a range into a container, deducing its element type.
+ * @details The container is C<std::ranges::range_value_t<R>>, see slice_to().
+ * @tparam C The container template, e.g. std::vector.
+ * @param r The range to materialize.
+ * @return The container.
+ */
+template <template <typename...> typename C, std::ranges::input_range R>
+[[nodiscard]] constexpr auto slice_to(R&& r)
+{
+  return dd::ranges::slice_to<C<std::ranges::range_value_t<R>>>(std::forward<R>(r));
+}
+
+} // namespace dd::ranges
@@ -0,0 +1,187 @@
+/**
+ * @file mapped_records.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/slice_view.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief A read-only, memory-mapped file of fixed-size records.
+ * @details The file is mapped as a contiguous range of T, so that slicing it with
+ * dd::views::slice yields a std::span over the mapping, without reading or copying
+ * the records. Every span slice advises the kernel that its pages will be needed soon
+ * and read sequentially (MADV_WILLNEED and MADV_SEQUENTIAL), for exactly the byte
+ * range of the slice, rounded out to whole pages. Slicing [start, end) of a large file
+ * thus only pages in the records of the slice.
+ *
+ * The records are the size of the file divided by sizeof(T); trailing bytes that do
+ * not make up a whole record are ignored. The mapping is owned and released on
+ * destruction, so mapped_records is move-only, and the spans sliced from it must not
+ * outlive it. Requires POSIX mmap.
+ * @tparam T The record type, which must be trivially copyable.
+ */
+template <typename T>
+  requires std::is_trivially_copyable_v<T>
+class mapped_records
+{
+public:
+  /**
+   * @brief Maps a file.
+   * @param path The path of the file.
+   * @throws std::system_error If the file cannot be opened, inspected or mapped.
+   */
+  explicit mapped_records(std::filesystem::path const& path)
+  {
+    const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+    {
+      throw std::system_error(errno, std::generic_category(), path.string());
+    }
+    // The mapping stays valid after the descriptor is closed.
+    struct close_on_exit
+    {
+      int fd;
+      ~close_on_exit() { ::close(fd); }
+    } closer{fd};
+
+    struct ::stat status = {};
+    if (::fstat(fd, &status) == -1)
+    {
+      throw std::system_error(errno, std::generic_category(), path.string());
+    }
+    size_ = static_cast<std::size_t>(status.st_size) / sizeof(T);
+    if (size_ == 0)
+    {
+      return;
+    }
+    auto* mapping = ::mmap(nullptr, bytes(), PROT_READ, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED)
+    {
+      throw std::system_error(errno, std::generic_category(), path.string());
+    }
+    data_ = static_cast<T const*>(mapping);
+  }
+
+  mapped_records(mapped_records const&) = delete;
+  auto operator=(mapped_records const&) -> mapped_records& = delete;
+
+  /**
+   * @brief Move constructor, leaving the other file empty.
+   * @param other The file to move.
+   */
+  mapped_records(mapped_records&& other) noexcept
+      : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)}
+  {
+  }
+
+  /**
+   * @brief Move assignment, unmapping the current file.
+   * @param other The file to move.
+   * @return This file.
+   */
+  auto operator=(mapped_records&& other) noexcept -> mapped_records&
+  {
+    if (this != &other)
+    {
+      unmap();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Destructor, unmapping the file.
+   */
+  ~mapped_records() { unmap(); }
+
+  [[nodiscard]] auto begin() const noexcept -> T const* { return data_; }
+  [[nodiscard]] auto end() const noexcept -> T const* { return data_ + size_; }
+  [[nodiscard]] auto data() const noexcept -> T const* { return data_; }
+  [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size_ == 0; }
+
+  [[nodiscard]] auto operator[](std::size_t n) const noexcept -> T const&
+  {
+    return data_[n];
+  }
+
+  /**
+   * @brief Advises the kernel that records will be read soon, and sequentially.
+   * @details The advice covers the pages of the records, and is only a hint: failures
+   * are ignored. The slice adaptor calls this for every span slice of the file.
+   * @param records Records of this file.
+   */
+  static auto advise(std::span<T const> records) noexcept -> void
+  {
+    if (records.empty())
+    {
+      return;
+    }
+    static const auto page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    const auto first = reinterpret_cast<std::uintptr_t>(records.data());
+    const auto last = first + records.size_bytes();
+    const auto page = first & ~(page_size - 1);
+    auto* address = reinterpret_cast<void*>(page);
+    ::madvise(address, last - page, MADV_WILLNEED);
+    ::madvise(address, last - page, MADV_SEQUENTIAL);
+  }
+
+private:
+  /**
+   * @brief Number of mapped bytes.
+   */
+  [[nodiscard]] auto bytes() const noexcept -> std::size_t { return size_ * sizeof(T); }
+
+  /**
+   * @brief Unmaps the file, if it is mapped.
+   */
+  auto unmap() noexcept -> void
+  {
+    if (data_ != nullptr)
+    {
+      ::munmap(const_cast<T*>(data_), bytes());
+    }
+  }
+
+  T const* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+/**
+ * @brief Span slice traits of mapped records, which advise the kernel of each slice.
+ */
+template <typename T>
+struct span_slice_traits<mapped_records<T>>
+{
+  static auto advise(std::span<T const> records) noexcept -> void
+  {
+    mapped_records<T>::advise(records);
+  }
+};
+
+} // namespace dd::ranges
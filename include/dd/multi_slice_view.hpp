@@ -0,0 +1,312 @@
+/**
+ * @file multi_slice_view.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/non_propagating_cache.hpp"
+#include "dd/slice_view.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief A random access range of many slices of one forward range.
+ *
+ * The slices are given as [start, end) intervals, in any order, and may overlap. Their
+ * boundaries are located by a single forward sweep over the base, on the first call of
+ * begin(), instead of one walk from the beginning of the base per slice. The total cost
+ * is then the largest ending index in increments, rather than the sum of all indices.
+ *
+ * The elements are slice_views of a reference to the base, whose caches are seeded with
+ * the located iterators, in the order the intervals were given. join() flattens them
+ * into one range. As for std::ranges::filter_view, begin() and end() are not const.
+ *
+ * Negative indices are counted from the end of the base, see from_end. If any index is
+ * negative, the base is measured first, by traversing it unless it is sized.
+ *
+ * Like the caches of slice_view, the located slices are not propagated to copies.
+ * @tparam R The base view.
+ */
+template <std::ranges::forward_range R>
+  requires std::ranges::view<R> && std::copy_constructible<R>
+class multi_slice_view : public std::ranges::view_interface<multi_slice_view<R>>
+{
+public:
+  /**
+   * @brief Alias for the ranges difference type.
+   */
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  /**
+   * @brief Alias for a [start, end) interval of a slice.
+   */
+  using interval_type = std::pair<difference_type, difference_type>;
+
+  /**
+   * @brief Alias for the type of the slices.
+   */
+  using slice_type = slice_view<std::ranges::ref_view<R>>;
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  constexpr multi_slice_view()
+    requires std::default_initializable<R>
+  = default;
+
+  /**
+   * @brief Constructor.
+   * @param base The base view.
+   * @param intervals The [start, end) intervals of the slices.
+   */
+  constexpr multi_slice_view(R base, std::vector<interval_type> intervals)
+      : base_{std::move(base)}, intervals_{std::move(intervals)}
+  {
+  }
+
+  /**
+   * @brief Gets a copy of the base view.
+   * @return A copy of the base view.
+   */
+  [[nodiscard]] constexpr auto base() const -> R { return base_; }
+
+  /**
+   * @brief Gets the intervals of the slices.
+   * @return The intervals, in the order they were given.
+   */
+  [[nodiscard]] constexpr auto intervals() const noexcept
+    -> std::span<interval_type const>
+  {
+    return intervals_;
+  }
+
+  /**
+   * @brief Gets an iterator to the first slice.
+   * @details Locates the boundaries of all slices, if they were not yet.
+   * @return Iterator to the first slice.
+   */
+  [[nodiscard]] constexpr auto begin() { return slices().begin(); }
+
+  /**
+   * @brief Gets an iterator past the last slice.
+   * @details Locates the boundaries of all slices, if they were not yet.
+   * @return Iterator past the last slice.
+   */
+  [[nodiscard]] constexpr auto end() { return slices().end(); }
+
+  /**
+   * @brief Gets the number of slices.
+   * @return The number of intervals.
+   */
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+  {
+    return intervals_.size();
+  }
+
+  /**
+   * @brief Flattens the slices into a single range.
+   * @return A join view over the slices. This view must outlive it.
+   */
+  [[nodiscard]] constexpr auto join()
+  {
+    return std::views::join(std::ranges::ref_view(*this));
+  }
+
+private:
+  /**
+   * @brief Gets the slices, locating all of their boundaries in one sweep if needed.
+   * @return Reference to the located slices.
+   */
+  [[nodiscard]] constexpr auto slices() -> std::vector<slice_type>&
+  {
+    return slices_.get_or_emplace([this] { return locate(); });
+  }
+
+  /**
+   * @brief Locates the boundaries of all slices in one forward sweep over the base.
+   * @return The slices, in the order of the intervals.
+   */
+  [[nodiscard]] constexpr auto locate() -> std::vector<slice_type>
+  {
+    const auto has_negative = std::ranges::any_of(
+      intervals_, [](auto const& interval)
+      { return interval.first < 0 || interval.second < 0; });
+    const auto base_size = [&]
+    {
+      if constexpr (std::ranges::sized_range<R>)
+      {
+        return static_cast<difference_type>(std::ranges::ssize(base_));
+      }
+      else
+      {
+        return has_negative ? std::ranges::distance(base_) : difference_type{0};
+      }
+    }();
+    // Non-negative indices, including from_end(0), are clamped by the sweep.
+    auto resolve = [&](difference_type index)
+    { return index < 0 ? std::max(base_size + index, difference_type{0}) : index; };
+
+    // Each interval contributes a starting and an ending boundary, which are visited in
+    // ascending order of their positions.
+    auto boundaries = std::vector<std::pair<difference_type, std::size_t>>{};
+    boundaries.reserve(2 * intervals_.size());
+    for (auto k = std::size_t{0}; k < intervals_.size(); ++k)
+    {
+      const auto start = resolve(intervals_[k].first);
+      const auto end = resolve(intervals_[k].second);
+      boundaries.emplace_back(start, 2 * k);
+      boundaries.emplace_back(std::max(start, end), 2 * k + 1);
+    }
+    std::ranges::sort(boundaries, {}, &std::pair<difference_type, std::size_t>::first);
+
+    auto iterators = std::vector<std::ranges::iterator_t<R>>(boundaries.size());
+    auto iter = std::ranges::begin(base_);
+    const auto last = std::ranges::end(base_);
+    auto position = difference_type{0};
+    for (auto const& [index, slot] : boundaries)
+    {
+      if (index > position && iter != last)
+      {
+        position += detail::counted_advance(iter, index - position, last);
+      }
+      iterators[slot] = iter;
+    }
+
+    auto slices = std::vector<slice_type>{};
+    slices.reserve(intervals_.size());
+    for (auto k = std::size_t{0}; k < intervals_.size(); ++k)
+    {
+      const auto start = resolve(intervals_[k].first);
+      const auto end = resolve(intervals_[k].second);
+      slices.emplace_back(
+        std::ranges::ref_view<R>(base_), start, std::max(start, end), iterators[2 * k],
+        iterators[2 * k + 1]);
+    }
+    return slices;
+  }
+
+  R base_{};
+  std::vector<interval_type> intervals_{};
+  non_propagating_cache<std::vector<slice_type>> slices_;
+};
+
+/**
+ * @brief Deduction guide for multi_slice_view.
+ * @details Wraps the input range type in std::views::all_t.
+ */
+template <typename R>
+multi_slice_view(
+  R&&,
+  std::vector<
+    std::pair<std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>>>)
+  -> multi_slice_view<std::views::all_t<R>>;
+
+} // namespace dd::ranges
+
+namespace dd::ranges::views
+{
+
+namespace detail
+{
+/**
+ * @brief Range adaptor closure for @c multi_slice_view.
+ * @tparam DifferenceType The index type of the intervals.
+ */
+template <std::integral DifferenceType>
+class multi_slice_range_adaptor
+    : public std::ranges::range_adaptor_closure<multi_slice_range_adaptor<DifferenceType>>
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param intervals The [start, end) intervals of the slices.
+   */
+  constexpr explicit multi_slice_range_adaptor(
+    std::vector<std::pair<DifferenceType, DifferenceType>> intervals)
+      : intervals_{std::move(intervals)}
+  {
+  }
+
+  /**
+   * @brief Required operator for range_adaptor_closure.
+   * @param range The range to slice.
+   * @return A multi_slice_view of the range.
+   */
+  template <std::ranges::viewable_range R>
+    requires std::ranges::forward_range<R>
+  [[nodiscard]] constexpr auto operator()(R&& r) const
+  {
+    using view_type = std::views::all_t<R>;
+    using difference_type = std::ranges::range_difference_t<view_type>;
+    auto intervals =
+      std::vector<std::pair<difference_type, difference_type>>(intervals_.size());
+    std::ranges::transform(
+      intervals_, intervals.begin(), [](auto const& interval)
+      {
+        return std::pair{
+          to_difference<difference_type>(interval.first),
+          to_difference<difference_type>(interval.second)};
+      });
+    return multi_slice_view<view_type>(
+      std::views::all(std::forward<R>(r)), std::move(intervals));
+  }
+
+private:
+  std::vector<std::pair<DifferenceType, DifferenceType>> intervals_;
+};
+
+/**
+ * @brief Range adaptor object type for @c multi_slice_view.
+ */
+struct multi_slice_fn
+{
+  /**
+   * @brief Creates a range adaptor closure.
+   * @param intervals The [start, end) intervals of the slices.
+   * @return The range adaptor closure.
+   */
+  template <std::integral D>
+  [[nodiscard]] constexpr auto operator()(std::vector<std::pair<D, D>> intervals) const
+  {
+    return multi_slice_range_adaptor<D>{std::move(intervals)};
+  }
+
+  /**
+   * @brief Creates a range adaptor closure from a braced list of intervals.
+   * @param intervals The [start, end) intervals of the slices.
+   * @return The range adaptor closure.
+   */
+  [[nodiscard]] constexpr auto
+  operator()(std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> intervals) const
+  {
+    return multi_slice_range_adaptor<std::ptrdiff_t>{std::move(intervals)};
+  }
+};
+} // namespace detail
+
+/**
+ * @brief Range adaptor object for multi_slice_view.
+ */
+inline constexpr auto multi_slice = detail::multi_slice_fn{};
+
+} // namespace dd::ranges::views
+
+namespace dd::views
+{
+using dd::ranges::views::multi_slice;
+} // namespace dd::views
@@ -10,14 +10,78 @@
 
 #pragma once
 
+#include "dd/slice_view_stats.hpp"
+
+#include <atomic>
 #include <concepts>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <type_traits>
+#include <utility>
 
 namespace dd
 {
 
+/**
+ * @brief Tag for a non_propagating_cache that is used by a single thread at a time.
+ */
+struct sequential_tag
+{
+};
+
+/**
+ * @brief Tag for a non_propagating_cache that is filled and read concurrently.
+ */
+struct concurrent_tag
+{
+};
+
+namespace detail
+{
+/**
+ * @brief Defers invoking a function until its result is converted to the cached type.
+ * @details Emplacing this wrapper into a std::optional selects the move constructor
+ * through the conversion operator, and the value is then constructed directly from the
+ * prvalue returned by the function (copy elision), whereas emplacing the result itself
+ * moves it from a temporary into the storage. This only holds if no constructor of the
+ * cached type accepts the wrapper itself, see elides_through_conversion.
+ * @tparam F The invocable type.
+ */
+template <typename F>
+struct deferred_invoke
+{
+  constexpr operator std::invoke_result_t<F>() const
+  {
+    return std::invoke(std::forward<F>(f));
+  }
+
+  F&& f;
+};
+
+template <typename F>
+deferred_invoke(F&&) -> deferred_invoke<F>;
+
+/**
+ * @brief An argument type that converts to nothing.
+ */
+struct unconvertible
+{
+};
+
+/**
+ * @brief Checks if emplacing a deferred_invoke of F constructs T through the conversion.
+ * @details This requires that F returns T, and that T is not constructible from an
+ * unrelated type, e.g. by a constructor template such as the one of std::any, which
+ * would be selected over the conversion and construct T from the wrapper itself.
+ * @tparam T The cached type.
+ * @tparam F The invocable type.
+ */
+template <typename T, typename F>
+concept elides_through_conversion =
+  std::same_as<std::invoke_result_t<F>, T> && !std::constructible_from<T, unconvertible>;
+} // namespace detail
+
 /**
  * @brief A cache which does not propagate its state.
  *
@@ -29,8 +93,11 @@ namespace dd
  * This class is particularly useful in range adaptors and views, where intermediate
  * results may be expensive to compute, but caching across copies would break the expected
  * behavior of view semantics.
+ *
+ * @tparam T The cached type.
+ * @tparam Tag Either sequential_tag or concurrent_tag.
  */
-template <typename T>
+template <typename T, typename Tag = sequential_tag>
   requires std::is_object_v<T>
 class non_propagating_cache
 {
@@ -48,6 +115,7 @@ public:
     [[maybe_unused]] non_propagating_cache const& other) noexcept
       : value_{std::nullopt}
   {
+    DD_SLICE_VIEW_STATS_RESET(other.value_.has_value());
   }
 
   /**
@@ -57,6 +125,7 @@ public:
   constexpr non_propagating_cache(non_propagating_cache&& other) noexcept
       : value_{std::nullopt}
   {
+    DD_SLICE_VIEW_STATS_RESET(other.value_.has_value());
     other.value_.reset();
   }
 
@@ -70,6 +139,7 @@ public:
   {
     if (this != std::addressof(other))
     {
+      DD_SLICE_VIEW_STATS_RESET(value_.has_value() || other.value_.has_value());
       value_.reset();
     }
     return *this;
@@ -83,6 +153,7 @@ public:
   constexpr auto operator=(non_propagating_cache&& other) noexcept
     -> non_propagating_cache&
   {
+    DD_SLICE_VIEW_STATS_RESET(value_.has_value() || other.value_.has_value());
     value_.reset();
     other.value_.reset();
     return *this;
@@ -124,8 +195,234 @@ public:
     return value_.emplace(std::forward<Args>(args)...);
   }
 
+  /**
+   * @brief Gets the cached value, or emplaces the result of an invocable.
+   * @details The result of f is constructed in place, so a prvalue result is neither
+   * copied nor moved into the cache.
+   * @param f Invocable that computes the value if none is cached.
+   * @return Reference to the cached value.
+   */
+  template <std::invocable F>
+  constexpr auto get_or_emplace(F&& f) -> T&
+    requires std::constructible_from<T, std::invoke_result_t<F>>
+  {
+    if (value_.has_value())
+    {
+      DD_SLICE_VIEW_STATS_HIT();
+      return *value_;
+    }
+    DD_SLICE_VIEW_STATS_MISS();
+    return emplace_result(std::forward<F>(f));
+  }
+
+private:
+  /**
+   * @brief Emplaces the result of an invocable, see detail::deferred_invoke.
+   * @param f Invocable that computes the value.
+   * @return Reference to the cached value.
+   */
+  template <typename F>
+  constexpr auto emplace_result(F&& f) -> T&
+  {
+    if constexpr (detail::elides_through_conversion<T, F>)
+    {
+      return value_.emplace(detail::deferred_invoke{std::forward<F>(f)});
+    }
+    else
+    {
+      return value_.emplace(std::invoke(std::forward<F>(f)));
+    }
+  }
+
+  std::optional<T> value_{};
+};
+
+/**
+ * @brief A cache which does not propagate its state, and can be filled concurrently.
+ *
+ * The value is filled at most once by get_or_emplace(): the first caller computes the
+ * value, concurrent callers wait for it, and every later call reads the cached value
+ * lock-free.
+ *
+ * Copies and moves follow the same rules as the sequential cache. Copying, moving,
+ * assigning and emplace() are not synchronized, and must not overlap other uses of the
+ * same object.
+ */
+template <typename T>
+  requires std::is_object_v<T>
+class non_propagating_cache<T, concurrent_tag>
+{
+public:
+  /**
+   * @brief Default constructor.
+   */
+  non_propagating_cache() = default;
+
+  /**
+   * @brief Copy constructor resets destination, leaves source unchanged.
+   * @param other Source object to copy from.
+   */
+  non_propagating_cache([[maybe_unused]] non_propagating_cache const& other) noexcept
+  {
+    DD_SLICE_VIEW_STATS_RESET(other.has_value());
+  }
+
+  /**
+   * @brief Move constructor resets both source and destination.
+   * @param other Source object to copy from.
+   */
+  non_propagating_cache(non_propagating_cache&& other) noexcept
+  {
+    DD_SLICE_VIEW_STATS_RESET(other.has_value());
+    other.reset();
+  }
+
+  /**
+   * @brief Copy-assignment resets destination, leaves source unchanged.
+   * @param other Source object to copy from.
+   * @return Reference to this.
+   */
+  auto operator=(non_propagating_cache const& other) noexcept -> non_propagating_cache&
+  {
+    if (this != std::addressof(other))
+    {
+      DD_SLICE_VIEW_STATS_RESET(has_value() || other.has_value());
+      reset();
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Move-assignment resets both source and destination.
+   * @param other Source object to copy from.
+   * @return Reference to this.
+   */
+  auto operator=(non_propagating_cache&& other) noexcept -> non_propagating_cache&
+  {
+    DD_SLICE_VIEW_STATS_RESET(has_value() || other.has_value());
+    reset();
+    other.reset();
+    return *this;
+  }
+
+  /**
+   * @brief Gets a l-value reference to the cached value.
+   * @return Reference to the cached value.
+   */
+  auto operator*(this auto& self) -> decltype(auto) { return *self.value_; }
+
+  /**
+   * @brief Gets a const l-value reference to the cached value.
+   * @return Reference to the cached value.
+   */
+  auto value(this auto& self) -> decltype(auto) { return *self.value_; }
+
+  /**
+   * @brief Checks if there is a cached value.
+   * @return True if a value is cached, false otherwise.
+   */
+  auto has_value() const -> bool
+  {
+    return state_.load(std::memory_order_acquire) == state::ready;
+  }
+
+  /**
+   * @brief Conversion to bool.
+   * @return True if a value is cached, false otherwise.
+   */
+  operator bool() const noexcept { return has_value(); };
+
+  /**
+   * @brief Emplace from constructor arguments.
+   * @param args Constructor arguments for T.
+   * @return Reference to this.
+   */
+  template <class... Args>
+  auto emplace(Args&&... args) -> T&
+    requires std::constructible_from<T, Args...>
+  {
+    auto& value = value_.emplace(std::forward<Args>(args)...);
+    state_.store(state::ready, std::memory_order_release);
+    return value;
+  }
+
+  /**
+   * @brief Gets the cached value, or emplaces the result of an invocable.
+   * @details Only one caller invokes f. Concurrent callers block until the value is
+   * cached. If f throws, the cache is left empty and another caller may fill it. The
+   * result of f is constructed in place, as for the sequential cache.
+   * @param f Invocable that computes the value if none is cached.
+   * @return Reference to the cached value.
+   */
+  template <std::invocable F>
+  auto get_or_emplace(F&& f) -> T&
+    requires std::constructible_from<T, std::invoke_result_t<F>>
+  {
+    auto current = state_.load(std::memory_order_acquire);
+    if (current == state::ready)
+    {
+      DD_SLICE_VIEW_STATS_HIT();
+      return *value_;
+    }
+    while (current != state::ready)
+    {
+      if (current == state::busy)
+      {
+        state_.wait(state::busy, std::memory_order_acquire);
+        current = state_.load(std::memory_order_acquire);
+      }
+      else if (state_.compare_exchange_weak(
+                 current, state::busy, std::memory_order_acquire,
+                 std::memory_order_acquire))
+      {
+        DD_SLICE_VIEW_STATS_MISS();
+        try
+        {
+          emplace_result(std::forward<F>(f));
+        }
+        catch (...)
+        {
+          state_.store(state::empty, std::memory_order_release);
+          state_.notify_all();
+          throw;
+        }
+        state_.store(state::ready, std::memory_order_release);
+        state_.notify_all();
+        break;
+      }
+    }
+    return *value_;
+  }
+
 private:
+  enum class state : unsigned char
+  {
+    empty,
+    busy,
+    ready
+  };
+
+  template <typename F>
+  auto emplace_result(F&& f) -> T&
+  {
+    if constexpr (detail::elides_through_conversion<T, F>)
+    {
+      return value_.emplace(detail::deferred_invoke{std::forward<F>(f)});
+    }
+    else
+    {
+      return value_.emplace(std::invoke(std::forward<F>(f)));
+    }
+  }
+
+  auto reset() noexcept -> void
+  {
+    value_.reset();
+    state_.store(state::empty, std::memory_order_relaxed);
+  }
+
   std::optional<T> value_{};
+  std::atomic<state> state_{state::empty};
 };
 
 } // namespace dd
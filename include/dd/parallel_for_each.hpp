@@ -0,0 +1,313 @@
+/**
+ * @file parallel_for_each.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace dd::ranges
+{
+
+namespace detail
+{
+/**
+ * @brief A chunk of consecutive elements, processed by one worker.
+ * @tparam I The iterator type.
+ */
+template <typename I>
+struct chunk_task
+{
+  I first;
+  std::iter_difference_t<I> count;
+};
+
+/**
+ * @brief Per-worker task queues with work stealing.
+ * @details Each worker pops chunks from the front of its own queue and, once it is
+ * empty, steals from the back of the other queues, so workers that finish their chunks
+ * early take over the chunks of slower workers. Chunks may be pushed while the workers
+ * run; workers sleep until a chunk is pushed or the producer is done.
+ * @tparam Task The task type.
+ */
+template <typename Task>
+class work_stealing_queues
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param workers Number of workers, each with its own queue.
+   */
+  explicit work_stealing_queues(std::size_t workers) : queues_(workers) {}
+
+  /**
+   * @brief Pushes a task to the queue of a worker, and wakes up a sleeping worker.
+   * @param worker The worker whose queue receives the task.
+   * @param task The task.
+   */
+  auto push(std::size_t worker, Task task) -> void
+  {
+    {
+      auto lock = std::scoped_lock{queues_[worker].mutex};
+      queues_[worker].tasks.push_back(std::move(task));
+    }
+    {
+      auto lock = std::scoped_lock{mutex_};
+      ++available_;
+    }
+    wake_.notify_one();
+  }
+
+  /**
+   * @brief Marks that no more tasks will be pushed, and wakes up all workers.
+   */
+  auto close() -> void
+  {
+    {
+      auto lock = std::scoped_lock{mutex_};
+      closed_ = true;
+    }
+    wake_.notify_all();
+  }
+
+  /**
+   * @brief Gets the next task of a worker, stealing from other workers if needed.
+   * @details Blocks until a task is available, or the queues are closed and empty.
+   * @param worker The worker.
+   * @return The task, or nothing once all tasks are done.
+   */
+  auto pop(std::size_t worker) -> std::optional<Task>
+  {
+    {
+      auto lock = std::unique_lock{mutex_};
+      wake_.wait(lock, [this] { return available_ > 0 || closed_; });
+      if (available_ == 0)
+      {
+        return std::nullopt;
+      }
+      // Claims a task. There are always at least as many tasks in the queues as there
+      // are pending claims, but a task that a scan would find may be taken by another
+      // claim first, so the queues are scanned until a task is found.
+      --available_;
+    }
+    while (true)
+    {
+      for (auto k = std::size_t{0}; k < queues_.size(); ++k)
+      {
+        if (auto task = take(worker, (worker + k) % queues_.size()))
+        {
+          return task;
+        }
+      }
+      std::this_thread::yield();
+    }
+  }
+
+private:
+  /**
+   * @brief A queue of tasks, with its own lock.
+   */
+  struct queue
+  {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  /**
+   * @brief Takes a task from a queue: from the front of the worker's own queue, and from
+   * the back of the others.
+   * @param worker The worker taking the task.
+   * @param victim The worker whose queue is taken from.
+   * @return The task, if the queue was not empty.
+   */
+  auto take(std::size_t worker, std::size_t victim) -> std::optional<Task>
+  {
+    auto& q = queues_[victim];
+    auto lock = std::scoped_lock{q.mutex};
+    if (q.tasks.empty())
+    {
+      return std::nullopt;
+    }
+    auto task = std::optional<Task>{};
+    if (victim == worker)
+    {
+      task.emplace(std::move(q.tasks.front()));
+      q.tasks.pop_front();
+    }
+    else
+    {
+      task.emplace(std::move(q.tasks.back()));
+      q.tasks.pop_back();
+    }
+    return task;
+  }
+
+  std::vector<queue> queues_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::size_t available_{0};
+  bool closed_{false};
+};
+} // namespace detail
+
+/**
+ * @brief Applies a function to every element of a range, such as a slice, in parallel.
+ * @details The range is split into chunks of grain elements, which are run on a pool of
+ * worker threads with work stealing, so that imbalanced costs per element still keep
+ * all workers busy.
+ *  - For sized random access ranges, the chunk boundaries are computed by arithmetic,
+ *    and each worker starts with a contiguous block of chunks.
+ *  - For other forward ranges, the calling thread produces the chunks by walking the
+ *    range once, and the workers process the first chunks while later ones are still
+ *    being located. The walk thus overlaps with the processing.
+ * The function is called concurrently from several threads, and must be safe to call so.
+ * Neither the order of the calls nor the thread of each element is specified. If a
+ * call throws, the remaining chunks are skipped and the first exception is rethrown
+ * after all workers have stopped.
+ * @param r The range of elements.
+ * @param f The function to apply to each element.
+ * @param threads Number of worker threads. Zero uses std::thread::hardware_concurrency().
+ * With one thread, the elements are processed sequentially by the calling thread.
+ * @param grain Number of elements per chunk. Zero chooses eight chunks per worker for
+ * sized ranges, and 1024 elements otherwise.
+ */
+template <std::ranges::forward_range R, typename F>
+  requires std::indirectly_unary_invocable<F&, std::ranges::iterator_t<R>>
+auto parallel_for_each(
+  R&& r, F f, std::size_t threads = 0, std::ranges::range_difference_t<R> grain = 0)
+  -> void
+{
+  using iterator = std::ranges::iterator_t<R>;
+  using difference_type = std::ranges::range_difference_t<R>;
+  using task = detail::chunk_task<iterator>;
+
+  if (threads == 0)
+  {
+    threads = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  if (threads == 1)
+  {
+    for (auto&& element : r)
+    {
+      std::invoke(f, element);
+    }
+    return;
+  }
+
+  constexpr auto chunks_per_worker = difference_type{8};
+  if (grain == 0)
+  {
+    if constexpr (std::ranges::sized_range<R>)
+    {
+      const auto workers = static_cast<difference_type>(threads);
+      const auto size = static_cast<difference_type>(std::ranges::size(r));
+      grain = std::max(size / (workers * chunks_per_worker), difference_type{1});
+    }
+    else
+    {
+      grain = 1024;
+    }
+  }
+  assert(grain > 0);
+
+  auto queues = detail::work_stealing_queues<task>(threads);
+  auto failed = std::atomic<bool>{false};
+  auto error = std::exception_ptr{};
+  auto error_mutex = std::mutex{};
+
+  auto work = [&](std::size_t worker)
+  {
+    while (auto chunk = queues.pop(worker))
+    {
+      if (failed.load(std::memory_order_relaxed))
+      {
+        continue;
+      }
+      try
+      {
+        auto iter = chunk->first;
+        for (auto n = difference_type{0}; n < chunk->count; ++n, ++iter)
+        {
+          std::invoke(f, *iter);
+        }
+      }
+      catch (...)
+      {
+        auto lock = std::scoped_lock{error_mutex};
+        if (!failed.exchange(true))
+        {
+          error = std::current_exception();
+        }
+      }
+    }
+  };
+
+  {
+    auto workers = std::vector<std::jthread>{};
+    // Closes the queues before the workers are joined, also if starting a worker or
+    // producing the chunks throws.
+    struct closer
+    {
+      detail::work_stealing_queues<task>& queues;
+      ~closer() { queues.close(); }
+    } close_on_exit{queues};
+
+    workers.reserve(threads);
+    for (auto w = std::size_t{0}; w < threads; ++w)
+    {
+      workers.emplace_back(work, w);
+    }
+
+    auto first = std::ranges::begin(r);
+    const auto last = std::ranges::end(r);
+    if constexpr (std::ranges::random_access_range<R> && std::ranges::sized_range<R>)
+    {
+      const auto size = static_cast<difference_type>(std::ranges::size(r));
+      const auto chunks = (size + grain - 1) / grain;
+      const auto per_worker = (chunks + static_cast<difference_type>(threads) - 1) /
+                              static_cast<difference_type>(threads);
+      for (auto k = difference_type{0}; k < chunks; ++k)
+      {
+        const auto offset = k * grain;
+        queues.push(
+          static_cast<std::size_t>(k / per_worker),
+          task{first + offset, std::min(grain, size - offset)});
+      }
+    }
+    else
+    {
+      for (auto k = std::size_t{0}; first != last && !failed.load(); ++k)
+      {
+        auto chunk_first = first;
+        const auto count = grain - std::ranges::advance(first, grain, last);
+        queues.push(k % threads, task{std::move(chunk_first), count});
+      }
+    }
+  }
+
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace dd::ranges
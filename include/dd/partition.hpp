@@ -0,0 +1,81 @@
+/**
+ * @file partition.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/slice_view.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief Splits a slice into n consecutive sub-slices of balanced sizes.
+ * @details See slice_view::split. The sub-slices refer to the base of the slice, which
+ * must outlive them.
+ * @param slice The slice to split.
+ * @param n Number of sub-slices.
+ * @return Vector of n sub-slices.
+ */
+template <typename R, typename Policy>
+[[nodiscard]] constexpr auto partition(slice_view<R, Policy>& slice, std::size_t n)
+{
+  return slice.split(n);
+}
+
+/**
+ * @brief Splits a slice into n consecutive sub-slices of balanced sizes.
+ * @details See slice_view::split. The sub-slices refer to the base of the slice, which
+ * must outlive them.
+ * @param slice The slice to split.
+ * @param n Number of sub-slices.
+ * @return Vector of n sub-slices.
+ */
+template <typename R, typename Policy>
+[[nodiscard]] constexpr auto partition(slice_view<R, Policy> const& slice, std::size_t n)
+{
+  return slice.split(n);
+}
+
+/**
+ * @brief Splits a span into n consecutive sub-spans of balanced sizes.
+ * @details This is the partition of slices that were collapsed into a std::span by the
+ * slice adaptor.
+ * @param slice The span to split.
+ * @param n Number of sub-spans.
+ * @return Vector of n sub-spans. The first (size() % n) sub-spans hold one more element
+ * than the others.
+ */
+template <typename T, std::size_t Extent>
+[[nodiscard]] constexpr auto partition(std::span<T, Extent> slice, std::size_t n)
+  -> std::vector<std::span<T>>
+{
+  assert(n > 0);
+
+  const auto quotient = slice.size() / n;
+  const auto remainder = slice.size() % n;
+
+  auto pieces = std::vector<std::span<T>>{};
+  pieces.reserve(n);
+  auto offset = std::size_t{0};
+  for (auto k = std::size_t{0}; k < n; ++k)
+  {
+    const auto piece_size = quotient + (k < remainder ? 1 : 0);
+    pieces.push_back(std::span<T>(slice).subspan(offset, piece_size));
+    offset += piece_size;
+  }
+  return pieces;
+}
+
+} // namespace dd::ranges
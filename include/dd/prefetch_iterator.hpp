@@ -0,0 +1,195 @@
+/**
+ * @file prefetch_iterator.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include <concepts>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define DD_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define DD_PREFETCH(address) static_cast<void>(address)
+#endif
+
+namespace dd::ranges
+{
+
+/**
+ * @brief An iterator that prefetches the elements a fixed distance ahead of it.
+ *
+ * A lead iterator is kept up to distance elements ahead of the current position, bounded
+ * by a sentinel, and the element under it is prefetched on every increment. For
+ * node-based ranges such as std::list or std::map, this overlaps the cache miss of
+ * loading a node with the work done on the elements before it.
+ *
+ * Prefetching cannot speed up walking without work per element: the address of the next
+ * node is only known once the current node is loaded, so the lead iterator pays the same
+ * misses as the walk itself. Only iteration that does work per element benefits, and only
+ * if the nodes are scattered in memory, e.g. on lists that outgrow the caches after
+ * many insertions and removals.
+ *
+ * Elements are only prefetched if the reference type is an lvalue reference, so that
+ * dereferencing the lead iterator does not compute anything (e.g. through a
+ * transform_view). The lead iterator is only a hint, so decrementing moves the current
+ * position only.
+ *
+ * @tparam I The underlying iterator type.
+ * @tparam S The sentinel type bounding the lead iterator.
+ */
+template <std::forward_iterator I, std::sentinel_for<I> S = I>
+class prefetch_iterator
+{
+public:
+  /**
+   * @brief Iterator concept tag.
+   */
+  using iterator_concept = std::conditional_t<
+    std::bidirectional_iterator<I>,
+    std::bidirectional_iterator_tag,
+    std::forward_iterator_tag>;
+
+  /**
+   * @brief Value type of the underlying iterator.
+   */
+  using value_type = std::iter_value_t<I>;
+
+  /**
+   * @brief Difference type of the underlying iterator.
+   */
+  using difference_type = std::iter_difference_t<I>;
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  prefetch_iterator() = default;
+
+  /**
+   * @brief Constructor.
+   * @details Advances the lead iterator by distance elements, bounded by the sentinel.
+   * @param current The current position.
+   * @param bound The bound of the lead iterator, e.g. the end of the base range.
+   * @param distance Number of elements to prefetch ahead. The end iterator of a range
+   * can use zero, since it is never incremented.
+   */
+  constexpr prefetch_iterator(I current, S bound, difference_type distance = 0)
+      : current_{std::move(current)}, lead_{current_}, bound_{std::move(bound)}
+  {
+    std::ranges::advance(lead_, distance, bound_);
+    prefetch();
+  }
+
+  /**
+   * @brief Gets the underlying iterator.
+   * @return Reference to the underlying iterator.
+   */
+  [[nodiscard]] constexpr auto base() const& noexcept -> I const& { return current_; }
+
+  /**
+   * @brief Gets the underlying iterator.
+   * @return The moved underlying iterator.
+   */
+  [[nodiscard]] constexpr auto base() && -> I { return std::move(current_); }
+
+  /**
+   * @brief Dereference operator.
+   * @return Reference of the underlying iterator.
+   */
+  [[nodiscard]] constexpr auto operator*() const -> decltype(auto) { return *current_; }
+
+  /**
+   * @brief Pre-increment operator.
+   * @details Also advances the lead iterator, and prefetches the element under it.
+   * @return Reference to this.
+   */
+  constexpr auto operator++() -> prefetch_iterator&
+  {
+    ++current_;
+    if (lead_ != bound_)
+    {
+      ++lead_;
+      prefetch();
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Post-increment operator.
+   * @return Copy of the iterator before incrementing.
+   */
+  constexpr auto operator++(int) -> prefetch_iterator
+  {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  /**
+   * @brief Pre-decrement operator.
+   * @return Reference to this.
+   */
+  constexpr auto operator--() -> prefetch_iterator&
+    requires std::bidirectional_iterator<I>
+  {
+    --current_;
+    return *this;
+  }
+
+  /**
+   * @brief Post-decrement operator.
+   * @return Copy of the iterator before decrementing.
+   */
+  constexpr auto operator--(int) -> prefetch_iterator
+    requires std::bidirectional_iterator<I>
+  {
+    auto tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(prefetch_iterator const& x, prefetch_iterator const& y) -> bool
+  {
+    return x.current_ == y.current_;
+  }
+
+  [[nodiscard]] friend constexpr auto iter_move(prefetch_iterator const& iter) noexcept(
+    noexcept(std::ranges::iter_move(iter.current_))) -> decltype(auto)
+  {
+    return std::ranges::iter_move(iter.current_);
+  }
+
+private:
+  /**
+   * @brief Prefetches the element under the lead iterator, if there is one.
+   */
+  constexpr auto prefetch() const -> void
+  {
+    if constexpr (std::is_lvalue_reference_v<std::iter_reference_t<I>>)
+    {
+      if !consteval
+      {
+        if (lead_ != bound_)
+        {
+          DD_PREFETCH(std::addressof(*lead_));
+        }
+      }
+    }
+  }
+
+  I current_{};
+  I lead_{};
+  S bound_{};
+};
+
+} // namespace dd::ranges
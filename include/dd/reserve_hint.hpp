@@ -0,0 +1,99 @@
+/**
+ * @file reserve_hint.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+
+namespace dd::ranges
+{
+
+namespace detail::reserve_hint_impl
+{
+// Blocks unqualified lookup, so that only ADL finds customizations.
+void reserve_hint() = delete;
+
+template <typename T>
+concept integer_like = std::integral<std::remove_cvref_t<T>> &&
+                       !std::same_as<std::remove_cvref_t<T>, bool>;
+
+template <typename R>
+concept has_member_reserve_hint = requires(R& r) {
+  { r.reserve_hint() } -> integer_like;
+};
+
+template <typename R>
+concept has_adl_reserve_hint = requires(R& r) {
+  { reserve_hint(r) } -> integer_like;
+};
+
+/**
+ * @brief Function object type of dd::ranges::reserve_hint.
+ */
+struct fn
+{
+  /**
+   * @brief Gets a hint for the number of elements of a range.
+   * @details Dispatches to, in order:
+   *  - the member r.reserve_hint(),
+   *  - std::ranges::size(r),
+   *  - a reserve_hint(r) found by argument-dependent lookup.
+   * This is a shim for the C++26 std::ranges::reserve_hint. A hint must be cheap to
+   * compute, i.e. must not traverse the range, but it may differ from the size. Unlike
+   * the C++26 std::ranges::reserve_hint, a member hint is preferred over the size, since
+   * the size of some ranges, e.g. slices of forward ranges, traverses them.
+   * @param r The range.
+   * @return The hint for the number of elements of r.
+   */
+  template <typename R>
+    requires has_member_reserve_hint<R> || std::ranges::sized_range<R> ||
+             has_adl_reserve_hint<R>
+  [[nodiscard]] constexpr auto operator()(R&& r) const
+  {
+    if constexpr (has_member_reserve_hint<R>)
+    {
+      return r.reserve_hint();
+    }
+    else if constexpr (std::ranges::sized_range<R>)
+    {
+      return std::ranges::size(r);
+    }
+    else
+    {
+      return reserve_hint(r);
+    }
+  }
+};
+} // namespace detail::reserve_hint_impl
+
+inline namespace cpo
+{
+/**
+ * @brief Customization point for a hint for the number of elements of a range.
+ * @details Ranges that are not sized opt in by providing a member reserve_hint(), or a
+ * free function reserve_hint(r) in the namespace of the range. slice_view provides one
+ * bounded by its indices, which matters for slices that are not sized: lazy-sentinel
+ * slices and slices of input ranges, and for slices of forward ranges, whose size is
+ * counted.
+ */
+inline constexpr auto reserve_hint = detail::reserve_hint_impl::fn{};
+} // namespace cpo
+
+/**
+ * @brief Concept for ranges that provide a hint for their number of elements.
+ * @details A shim for the C++26 std::ranges::approximately_sized_range.
+ */
+template <typename R>
+concept approximately_sized_range =
+  std::ranges::range<R> && requires(R& r) { dd::ranges::reserve_hint(r); };
+
+} // namespace dd::ranges
@@ -0,0 +1,364 @@
+/**
+ * @file segmented_range.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/non_propagating_cache.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief Traits of ranges whose elements are stored in consecutive segments.
+ * @details A specialization provides a static member function segments(r), returning a
+ * forward range of the segments of r, in order. Joining the segments yields the elements
+ * of r. The primary template is not a segmented range.
+ *
+ * The traits are specialized for std::ranges::join_view, and for std::ranges::ref_view
+ * of a segmented range. Users may specialize them for their own segmented containers.
+ * @tparam R The range type, without cv or reference qualifiers.
+ */
+template <typename R>
+struct segmented_range_traits
+{
+};
+
+/**
+ * @brief Segmented range traits of a join view, whose segments are its inner ranges.
+ */
+template <typename V>
+struct segmented_range_traits<std::ranges::join_view<V>>
+{
+  template <typename J>
+  [[nodiscard]] static constexpr auto segments(J& r)
+    requires std::copy_constructible<V>
+  {
+    return r.base();
+  }
+};
+
+/**
+ * @brief Segmented range traits of a reference to a segmented range.
+ */
+template <typename R>
+struct segmented_range_traits<std::ranges::ref_view<R>>
+{
+  template <typename Ref>
+  [[nodiscard]] static constexpr auto segments(Ref& r)
+    -> decltype(segmented_range_traits<std::remove_cv_t<R>>::segments(r.base()))
+  {
+    return segmented_range_traits<std::remove_cv_t<R>>::segments(r.base());
+  }
+};
+
+/**
+ * @brief Gets the segments of a segmented range.
+ */
+template <typename R>
+using segments_t =
+  decltype(segmented_range_traits<std::remove_cvref_t<R>>::segments(std::declval<R&>()));
+
+/**
+ * @brief Concept for ranges that can be positioned by skipping whole segments.
+ * @details The segments must be a forward range of sized random access ranges, and
+ * iterators into a segment must outlive the dereferenced segment: the segments are
+ * either lvalues, which stay alive with the range of segments that the slice keeps, or
+ * borrowed ranges. Segments that are owning prvalues, e.g. the std::vectors returned by
+ * a std::views::transform, are destroyed with the iteration that reads them, so a
+ * join_view of them is not segmented.
+ */
+template <typename R>
+concept segmented_range =
+  requires { typename segments_t<R>; } &&
+  std::ranges::forward_range<segments_t<R>> &&
+  std::ranges::random_access_range<std::ranges::range_reference_t<segments_t<R>>> &&
+  std::ranges::sized_range<std::ranges::range_reference_t<segments_t<R>>> &&
+  (std::is_lvalue_reference_v<std::ranges::range_reference_t<segments_t<R>>> ||
+   std::ranges::borrowed_range<std::ranges::range_reference_t<segments_t<R>>>);
+
+/**
+ * @brief A slice of a segmented range, positioned by skipping whole segments.
+ * @details The segments before the slice are skipped using their sizes, and only the
+ * first and last segments of the slice are trimmed, so positioning costs O(segments)
+ * instead of O(elements). Negative indices are resolved against the sum of the segment
+ * sizes. The maximum index denotes the end of the range, see from_end.
+ *
+ * Nothing is located until the slice is first iterated. Like a slice_view, the slice
+ * then caches its position and length, which are not propagated to copies. begin()
+ * fills the cache, so the slice is not const-iterable. The iterators step through the
+ * segments of the slice and stop after its last element, so the slice is a sized
+ * forward range whose end is a std::default_sentinel_t.
+ * @tparam V The segmented base view.
+ */
+template <std::ranges::view V>
+  requires segmented_range<V&>
+class segmented_slice_view : public std::ranges::view_interface<segmented_slice_view<V>>
+{
+  using segments_type = segments_t<V&>;
+  using segment_iterator = std::ranges::iterator_t<segments_type>;
+  using segment_type = std::ranges::range_reference_t<segments_type>;
+  using element_iterator = std::ranges::iterator_t<segment_type>;
+
+public:
+  /**
+   * @brief Alias for the ranges difference type.
+   */
+  using difference_type = std::ranges::range_difference_t<V>;
+
+  /**
+   * @brief Iterator over the elements of the trimmed segments.
+   */
+  class iterator
+  {
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = std::ranges::range_value_t<segment_type>;
+    using difference_type = segmented_slice_view::difference_type;
+
+    iterator() = default;
+
+    /**
+     * @brief Constructor.
+     * @param segment Iterator to the segment holding the element.
+     * @param element Iterator to the element.
+     * @param segment_end Iterator to the end of the segment.
+     * @param remaining Number of elements of the slice from this one.
+     */
+    constexpr iterator(
+      segment_iterator segment,
+      element_iterator element,
+      element_iterator segment_end,
+      difference_type remaining)
+        : segment_{std::move(segment)},
+          element_{std::move(element)},
+          segment_end_{std::move(segment_end)},
+          remaining_{remaining}
+    {
+    }
+
+    [[nodiscard]] constexpr auto operator*() const -> decltype(auto) { return *element_; }
+
+    /**
+     * @brief Pre-increment operator.
+     * @details Steps to the next non-empty segment at the end of a segment, unless this
+     * was the last element of the slice.
+     * @return Reference to this.
+     */
+    constexpr auto operator++() -> iterator&
+    {
+      ++element_;
+      if (--remaining_ > 0)
+      {
+        while (element_ == segment_end_)
+        {
+          ++segment_;
+          auto&& segment = *segment_;
+          element_ = std::ranges::begin(segment);
+          segment_end_ = element_ + std::ranges::ssize(segment);
+        }
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Post-increment operator.
+     * @return Copy of the iterator before incrementing.
+     */
+    constexpr auto operator++(int) -> iterator
+    {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(
+      iterator const& lhs, iterator const& rhs) -> bool
+    {
+      return lhs.remaining_ == rhs.remaining_;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(
+      iterator const& it, std::default_sentinel_t) -> bool
+    {
+      return it.remaining_ == 0;
+    }
+
+  private:
+    segment_iterator segment_{};
+    element_iterator element_{};
+    element_iterator segment_end_{};
+    difference_type remaining_{0};
+  };
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  constexpr segmented_slice_view()
+    requires std::default_initializable<V>
+  = default;
+
+  /**
+   * @brief Constructor.
+   * @param base The segmented base view.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   */
+  constexpr segmented_slice_view(V base, difference_type start, difference_type end)
+      : base_{std::move(base)}, start_index_{start}, end_index_{end}
+  {
+  }
+
+  /**
+   * @brief Gets a copy of the base view.
+   * @return A copy of the base view.
+   */
+  [[nodiscard]] constexpr auto base() const -> V
+    requires std::copy_constructible<V>
+  {
+    return base_;
+  }
+
+  /**
+   * @brief Gets an iterator to the beginning of the slice, locating it on the first call.
+   * @return Iterator to the first element of the slice.
+   */
+  [[nodiscard]] constexpr auto begin() -> iterator
+  {
+    auto& slice = locate();
+    return iterator{slice.segment, slice.element, slice.segment_end, slice.length};
+  }
+
+  /**
+   * @brief Gets the end of the slice.
+   * @return The sentinel that compares equal to iterators past the last element.
+   */
+  [[nodiscard]] constexpr auto end() const noexcept -> std::default_sentinel_t
+  {
+    return std::default_sentinel;
+  }
+
+  /**
+   * @brief Gets the size of the slice, locating it on the first call.
+   * @return Number of elements of the slice.
+   */
+  [[nodiscard]] constexpr auto size() -> std::make_unsigned_t<difference_type>
+  {
+    return static_cast<std::make_unsigned_t<difference_type>>(locate().length);
+  }
+
+private:
+  /**
+   * @brief The segments of the base, and the position and length of the slice in them.
+   * @details Holds iterators into its own range of segments, so it is constructed in
+   * place in the cache and never copied or moved.
+   */
+  struct located
+  {
+    located(V& base, difference_type start, difference_type end)
+        : segments{segmented_range_traits<std::remove_cv_t<V>>::segments(base)}
+    {
+      auto segment_size = [](auto&& s)
+      { return static_cast<difference_type>(std::ranges::ssize(s)); };
+
+      if (start < 0 || end < 0)
+      {
+        auto size = difference_type{0};
+        for (auto&& s : segments)
+        {
+          size += segment_size(s);
+        }
+        start = start < 0 ? std::max(size + start, difference_type{0}) : start;
+        end = end < 0 ? std::max(size + end, difference_type{0}) : end;
+      }
+      end = std::max(start, end);
+
+      auto position = difference_type{0};
+      segment = std::ranges::begin(segments);
+      const auto segments_end = std::ranges::end(segments);
+      for (auto iter = segment; iter != segments_end && position < end; ++iter)
+      {
+        auto&& s = *iter;
+        const auto segment_begin = position;
+        position += segment_size(s);
+        if (position > start && segment_begin <= start)
+        {
+          segment = iter;
+          element = std::ranges::begin(s) + (start - segment_begin);
+          segment_end = std::ranges::begin(s) + segment_size(s);
+        }
+      }
+      length = std::max(std::min(end, position) - start, difference_type{0});
+    }
+
+    located(located const&) = delete;
+    auto operator=(located const&) -> located& = delete;
+
+    segments_type segments;
+    segment_iterator segment{};
+    element_iterator element{};
+    element_iterator segment_end{};
+    difference_type length{0};
+  };
+
+  /**
+   * @brief Gets the located slice, locating it if it is not cached.
+   * @return Reference to the cached slice.
+   */
+  constexpr auto locate() -> located&
+  {
+    if (!slice_.has_value())
+    {
+      slice_.emplace(base_, start_index_, end_index_);
+    }
+    return *slice_;
+  }
+
+  V base_{};
+  difference_type start_index_{0};
+  difference_type end_index_{0};
+  non_propagating_cache<located> slice_{};
+};
+
+/**
+ * @brief Deduction guide for segmented_slice_view.
+ * @details Wraps the input range type in std::views::all_t.
+ */
+template <typename R>
+segmented_slice_view(
+  R&&, std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>)
+  -> segmented_slice_view<std::views::all_t<R>>;
+
+namespace detail
+{
+/**
+ * @brief Slices a segmented range by skipping whole segments, see segmented_slice_view.
+ * @param r The segmented range to slice.
+ * @param start Starting index of the slice.
+ * @param end Ending index of the slice.
+ * @return A segmented_slice_view over the range, which locates the slice when it is
+ * first iterated.
+ */
+template <segmented_range R>
+[[nodiscard]] constexpr auto make_segmented_slice(
+  R&& r,
+  std::ranges::range_difference_t<R> start,
+  std::ranges::range_difference_t<R> end)
+{
+  return segmented_slice_view(std::views::all(std::forward<R>(r)), start, end);
+}
+} // namespace detail
+
+} // namespace dd::ranges
@@ -0,0 +1,570 @@
+/**
+ * @file slice2d_view.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/maybe_present.hpp"
+#include "dd/slice_view.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief Tag for a slice2d_view of a range of rows, e.g. std::vector<std::vector<T>>.
+ */
+struct nested_tag
+{
+};
+
+/**
+ * @brief Tag for a slice2d_view of a flat buffer of elements with a row stride.
+ */
+struct flat_tag
+{
+};
+
+namespace detail
+{
+/**
+ * @brief Concept for random access ranges of rows, e.g. std::vector<std::vector<T>>.
+ * @details The rows must be random access and sized, and must outlive the references to
+ * them, so that iterators into a row remain valid.
+ */
+template <typename R>
+concept nested_rows =
+  std::ranges::random_access_range<std::ranges::range_reference_t<R>> &&
+  std::ranges::sized_range<std::ranges::range_reference_t<R>> &&
+  (std::is_lvalue_reference_v<std::ranges::range_reference_t<R>> ||
+   std::ranges::borrowed_range<std::ranges::range_reference_t<R>>);
+
+/**
+ * @brief The iterator type of the elements of a matrix.
+ * @details Iterators of the rows for nested matrices, and of the buffer otherwise.
+ */
+template <typename R, bool Nested = nested_rows<R>>
+struct matrix_iterator
+{
+  using type = std::ranges::iterator_t<R>;
+};
+
+template <typename R>
+struct matrix_iterator<R, true>
+{
+  using type = std::ranges::iterator_t<std::ranges::range_reference_t<R>>;
+};
+
+/**
+ * @brief Gets the default layout of a matrix: nested if its elements are rows.
+ */
+template <typename R>
+using default_layout_t = std::conditional_t<nested_rows<R const>, nested_tag, flat_tag>;
+
+/**
+ * @brief Checks if a layout can be used for a matrix.
+ * @details Any random access range is a flat buffer, and nested matrices need rows.
+ */
+template <typename R, typename Layout>
+concept matrix_layout =
+  std::same_as<Layout, flat_tag> ||
+  (std::same_as<Layout, nested_tag> && nested_rows<R const>);
+} // namespace detail
+
+/**
+ * @brief A two-dimensional slice of a matrix.
+ *
+ * The matrix is either a range of rows (nested, e.g. std::vector<std::vector<T>>), or a
+ * flat buffer whose rows start every stride elements. A base whose elements are sized
+ * random access ranges is nested by default, and a flat buffer of such elements (e.g. a
+ * std::vector<std::array<float, 4>> in row-major order) is sliced with flat_tag, which
+ * is selected by constructing the slice, or the adaptor, with a stride.
+ *
+ * The slice selects the rows [rows.first, rows.second) and the columns
+ * [cols.first, cols.second) of every selected row. Negative indices are counted from
+ * the end, see from_end: for rows against the number of rows, and for columns against
+ * the stride, or the length of the first selected row of a nested matrix. Every
+ * selected row must hold the selected columns.
+ *
+ * The slice is a forward range of its elements in row-major order. The iterator moves
+ * to the next row by indexing the base, without constructing a view per row, as a
+ * std::views::transform of slice_views would. Elements are accessed by their
+ * coordinates with operator[](i, j), and tiles() yields the slice in blocks for
+ * cache-friendly processing. The base must be const-iterable, as are std::span,
+ * std::ranges::ref_view and std::ranges::owning_view.
+ * @tparam R The base view, a random access range of rows or of elements.
+ * @tparam Layout Either nested_tag or flat_tag.
+ */
+template <
+  std::ranges::random_access_range R, typename Layout = detail::default_layout_t<R>>
+  requires std::ranges::view<R> && std::ranges::sized_range<R> &&
+           std::ranges::random_access_range<R const> &&
+           detail::matrix_layout<R, Layout>
+class slice2d_view : public std::ranges::view_interface<slice2d_view<R, Layout>>
+{
+  static constexpr bool nested = std::same_as<Layout, nested_tag>;
+  using element_iterator = typename detail::matrix_iterator<R const, nested>::type;
+
+  class iterator;
+
+public:
+  /**
+   * @brief Alias for the ranges difference type.
+   */
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  /**
+   * @brief Alias for a [start, end) interval of rows or columns.
+   */
+  using interval_type = std::pair<difference_type, difference_type>;
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  constexpr slice2d_view()
+    requires std::default_initializable<R>
+  = default;
+
+  /**
+   * @brief Constructor for nested matrices.
+   * @param base The range of rows.
+   * @param rows The [start, end) interval of the rows.
+   * @param cols The [start, end) interval of the columns.
+   */
+  constexpr slice2d_view(R base, interval_type rows, interval_type cols)
+    requires nested
+      : base_{std::move(base)}
+  {
+    resolve(rows, cols, static_cast<difference_type>(std::ranges::ssize(base_)));
+  }
+
+  /**
+   * @brief Constructor for flat buffers with a row stride.
+   * @param base The buffer of elements.
+   * @param rows The [start, end) interval of the rows.
+   * @param cols The [start, end) interval of the columns.
+   * @param stride Number of elements from the beginning of a row to the next.
+   */
+  constexpr slice2d_view(
+    R base, interval_type rows, interval_type cols, difference_type stride)
+    requires(!nested)
+      : base_{std::move(base)}, stride_{stride}
+  {
+    assert(stride > 0);
+    const auto size = static_cast<difference_type>(std::ranges::ssize(base_));
+    resolve(rows, cols, (size + stride - 1) / stride);
+    assert(rows_ == 0 || (row_start_ + rows_ - 1) * stride + col_start_ + cols_ <= size);
+  }
+
+  /**
+   * @brief Gets a copy of the base view.
+   * @return A copy of the base view.
+   */
+  [[nodiscard]] constexpr auto base() const -> R
+    requires std::copy_constructible<R>
+  {
+    return base_;
+  }
+
+  /**
+   * @brief Gets the number of selected rows.
+   * @return The number of rows.
+   */
+  [[nodiscard]] constexpr auto rows() const noexcept -> difference_type { return rows_; }
+
+  /**
+   * @brief Gets the number of selected columns.
+   * @return The number of columns.
+   */
+  [[nodiscard]] constexpr auto cols() const noexcept -> difference_type { return cols_; }
+
+  /**
+   * @brief Gets the number of elements.
+   * @return The number of rows times the number of columns.
+   */
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+  {
+    return static_cast<std::size_t>(rows_ * cols_);
+  }
+
+  /**
+   * @brief Gets an iterator to the first element in row-major order.
+   * @return Iterator to the first element.
+   */
+  [[nodiscard]] constexpr auto begin() const -> iterator
+  {
+    if (rows_ == 0 || cols_ == 0)
+    {
+      return end();
+    }
+    return iterator{this, row_begin(0), 0};
+  }
+
+  /**
+   * @brief Gets an iterator past the last element.
+   * @return Iterator past the last element.
+   */
+  [[nodiscard]] constexpr auto end() const -> iterator
+  {
+    return iterator{this, {}, rows_};
+  }
+
+  /**
+   * @brief Gets an element by its coordinates in the slice.
+   * @param i Row of the element.
+   * @param j Column of the element.
+   * @return Reference to the element.
+   */
+  [[nodiscard]] constexpr auto operator[](difference_type i, difference_type j) const
+    -> decltype(auto)
+  {
+    assert(i >= 0 && i < rows_ && j >= 0 && j < cols_);
+    return row_begin(i)[j];
+  }
+
+  /**
+   * @brief Gets the selected columns of a row.
+   * @param i Row of the slice.
+   * @return A subrange of the elements of the row.
+   */
+  [[nodiscard]] constexpr auto row(difference_type i) const
+  {
+    assert(i >= 0 && i < rows_);
+    auto first = row_begin(i);
+    return std::ranges::subrange(first, first + cols_);
+  }
+
+  /**
+   * @brief Gets the slice in tiles, for block processing.
+   * @details The tiles are in row-major order, and each tile is a slice2d_view of the
+   * base. Tiles at the right and bottom edges are clipped. Joining the tiles iterates the
+   * elements in tiled order. The tiles are computed from this view, which must outlive
+   * them.
+   * @param tile_rows Number of rows per tile.
+   * @param tile_cols Number of columns per tile.
+   * @return A random access range of the tiles.
+   */
+  [[nodiscard]] constexpr auto
+  tiles(difference_type tile_rows, difference_type tile_cols) const
+    requires std::copy_constructible<R>
+  {
+    assert(tile_rows > 0 && tile_cols > 0);
+    const auto across = (cols_ + tile_cols - 1) / tile_cols;
+    const auto down = (rows_ + tile_rows - 1) / tile_rows;
+    return std::views::iota(difference_type{0}, down * across) |
+           std::views::transform(
+             [this, tile_rows, tile_cols, across](difference_type k)
+             {
+               const auto top = k / across * tile_rows;
+               const auto left = k % across * tile_cols;
+               return slice2d_view(
+                 *this, row_start_ + top, std::min(tile_rows, rows_ - top),
+                 col_start_ + left, std::min(tile_cols, cols_ - left));
+             });
+  }
+
+private:
+  /**
+   * @brief Constructor for a tile of a slice, with resolved indices.
+   * @param parent The slice that the tile is part of.
+   * @param row_start Starting row of the tile in the base.
+   * @param rows Number of rows of the tile.
+   * @param col_start Starting column of the tile in the base.
+   * @param cols Number of columns of the tile.
+   */
+  constexpr slice2d_view(
+    slice2d_view const& parent, difference_type row_start, difference_type rows,
+    difference_type col_start, difference_type cols)
+      : base_{parent.base_}, row_start_{row_start}, rows_{rows}, col_start_{col_start},
+        cols_{cols}, stride_{parent.stride_}
+  {
+  }
+
+  /**
+   * @brief Resolves the intervals against the shape of the base.
+   * @param rows The [start, end) interval of the rows.
+   * @param cols The [start, end) interval of the columns.
+   * @param row_count Number of rows of the base.
+   */
+  constexpr auto
+  resolve(interval_type rows, interval_type cols, difference_type row_count) -> void
+  {
+    row_start_ = detail::resolve_index(rows.first, row_count);
+    const auto row_end = detail::resolve_index(rows.second, row_count);
+    rows_ = std::max(row_end, row_start_) - row_start_;
+    const auto width = [&]
+    {
+      if constexpr (nested)
+      {
+        const auto first_row = std::ranges::begin(base_) + row_start_;
+        return rows_ == 0 ? difference_type{0}
+                          : static_cast<difference_type>(std::ranges::ssize(*first_row));
+      }
+      else
+      {
+        return stride_;
+      }
+    }();
+    col_start_ = detail::resolve_index(cols.first, width);
+    const auto col_end = detail::resolve_index(cols.second, width);
+    cols_ = std::max(col_end, col_start_) - col_start_;
+  }
+
+  /**
+   * @brief Gets the iterator to the first selected element of a row.
+   * @param i Row of the slice.
+   * @return Iterator of the row, or of the buffer, at the starting column.
+   */
+  [[nodiscard]] constexpr auto row_begin(difference_type i) const -> element_iterator
+  {
+    if constexpr (nested)
+    {
+      auto&& row = std::ranges::begin(base_)[row_start_ + i];
+      assert(std::ranges::ssize(row) >= col_start_ + cols_);
+      return std::ranges::begin(row) + col_start_;
+    }
+    else
+    {
+      return std::ranges::begin(base_) + (row_start_ + i) * stride_ + col_start_;
+    }
+  }
+
+  R base_{};
+  difference_type row_start_{0};
+  difference_type rows_{0};
+  difference_type col_start_{0};
+  difference_type cols_{0};
+  [[no_unique_address]] maybe_present_t<!nested, difference_type> stride_{1};
+};
+
+/**
+ * @brief Forward iterator over the elements of a slice2d_view in row-major order.
+ */
+template <std::ranges::random_access_range R, typename Layout>
+  requires std::ranges::view<R> && std::ranges::sized_range<R> &&
+           std::ranges::random_access_range<R const> &&
+           detail::matrix_layout<R, Layout>
+class slice2d_view<R, Layout>::iterator
+{
+  using base_iterator = element_iterator;
+
+public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::iter_value_t<base_iterator>;
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  iterator() = default;
+
+  constexpr iterator(
+    slice2d_view const* parent, base_iterator current, difference_type row)
+      : parent_{parent}, current_{std::move(current)}, row_{row}
+  {
+  }
+
+  [[nodiscard]] constexpr auto operator*() const -> std::iter_reference_t<base_iterator>
+  {
+    return *current_;
+  }
+
+  /**
+   * @brief Moves to the next element, and to the beginning of the next row after the
+   * last column.
+   * @return Reference to this.
+   */
+  constexpr auto operator++() -> iterator&
+  {
+    if (++col_ < parent_->cols_)
+    {
+      ++current_;
+    }
+    else
+    {
+      col_ = 0;
+      if (++row_ < parent_->rows_)
+      {
+        current_ = parent_->row_begin(row_);
+      }
+      else
+      {
+        current_ = base_iterator{};
+      }
+    }
+    return *this;
+  }
+
+  constexpr auto operator++(int) -> iterator
+  {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(iterator const& x, iterator const& y)
+    -> bool
+  {
+    return x.row_ == y.row_ && x.col_ == y.col_;
+  }
+
+private:
+  slice2d_view const* parent_{nullptr};
+  base_iterator current_{};
+  difference_type row_{0};
+  difference_type col_{0};
+};
+
+/**
+ * @brief Deduction guide for nested slice2d_view.
+ * @details Wraps the input range type in std::views::all_t.
+ */
+template <typename R>
+slice2d_view(
+  R&&,
+  std::pair<std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>>,
+  std::pair<std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>>)
+  -> slice2d_view<std::views::all_t<R>>;
+
+/**
+ * @brief Deduction guide for flat slice2d_view.
+ * @details Wraps the input range type in std::views::all_t. A stride selects flat_tag,
+ * even if the elements are ranges.
+ */
+template <typename R>
+slice2d_view(
+  R&&,
+  std::pair<std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>>,
+  std::pair<std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>>,
+  std::ranges::range_difference_t<R>) -> slice2d_view<std::views::all_t<R>, flat_tag>;
+
+} // namespace dd::ranges
+
+namespace dd::ranges::views
+{
+
+namespace detail
+{
+/**
+ * @brief Alias for a [start, end) interval of rows or columns.
+ */
+using slice2d_interval = std::pair<std::ptrdiff_t, std::ptrdiff_t>;
+
+/**
+ * @brief Range adaptor closure for @c slice2d_view.
+ * @tparam Layout Either nested_tag or flat_tag.
+ */
+template <typename Layout>
+class slice2d_range_adaptor
+    : public std::ranges::range_adaptor_closure<slice2d_range_adaptor<Layout>>
+{
+public:
+  /**
+   * @brief Alias for a [start, end) interval of rows or columns.
+   */
+  using interval_type = slice2d_interval;
+
+  /**
+   * @brief Constructor.
+   * @param rows The [start, end) interval of the rows.
+   * @param cols The [start, end) interval of the columns.
+   * @param stride The row stride of flat buffers, unused for nested matrices.
+   */
+  constexpr slice2d_range_adaptor(
+    interval_type rows, interval_type cols, std::ptrdiff_t stride)
+      : rows_{rows}, cols_{cols}, stride_{stride}
+  {
+  }
+
+  /**
+   * @brief Required operator for range_adaptor_closure.
+   * @param range The matrix to slice.
+   * @return A slice2d_view of the matrix.
+   */
+  template <std::ranges::viewable_range R>
+    requires std::ranges::random_access_range<R> && std::ranges::sized_range<R> &&
+             ranges::detail::matrix_layout<std::views::all_t<R>, Layout>
+  [[nodiscard]] constexpr auto operator()(R&& r) const
+  {
+    using view_type = std::views::all_t<R>;
+    using difference_type = std::ranges::range_difference_t<view_type>;
+    using interval = std::pair<difference_type, difference_type>;
+    const auto rows = interval(rows_);
+    const auto cols = interval(cols_);
+    if constexpr (std::same_as<Layout, nested_tag>)
+    {
+      return slice2d_view<view_type, nested_tag>(
+        std::views::all(std::forward<R>(r)), rows, cols);
+    }
+    else
+    {
+      return slice2d_view<view_type, flat_tag>(
+        std::views::all(std::forward<R>(r)), rows, cols,
+        static_cast<difference_type>(stride_));
+    }
+  }
+
+private:
+  interval_type rows_;
+  interval_type cols_;
+  std::ptrdiff_t stride_;
+};
+
+/**
+ * @brief Range adaptor object type for @c slice2d_view.
+ */
+struct slice2d_fn
+{
+  /**
+   * @brief Creates a range adaptor closure for nested matrices.
+   * @param rows The [start, end) interval of the rows.
+   * @param cols The [start, end) interval of the columns.
+   * @return The range adaptor closure.
+   */
+  [[nodiscard]] constexpr auto operator()(slice2d_interval rows, slice2d_interval cols)
+    const -> slice2d_range_adaptor<nested_tag>
+  {
+    return {rows, cols, 0};
+  }
+
+  /**
+   * @brief Creates a range adaptor closure for flat buffers with a row stride.
+   * @details The base is a flat buffer, even if its elements are ranges.
+   * @param rows The [start, end) interval of the rows.
+   * @param cols The [start, end) interval of the columns.
+   * @param stride Number of elements from the beginning of a row to the next.
+   * @return The range adaptor closure.
+   */
+  [[nodiscard]] constexpr auto operator()(
+    slice2d_interval rows, slice2d_interval cols, std::ptrdiff_t stride) const
+    -> slice2d_range_adaptor<flat_tag>
+  {
+    assert(stride > 0);
+    return {rows, cols, stride};
+  }
+};
+} // namespace detail
+
+/**
+ * @brief Range adaptor object for slice2d_view.
+ */
+inline constexpr auto slice2d = detail::slice2d_fn{};
+
+} // namespace dd::ranges::views
+
+namespace dd::views
+{
+using dd::ranges::views::slice2d;
+} // namespace dd::views
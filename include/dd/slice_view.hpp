@@ -10,14 +10,27 @@
 
 #pragma once
 
+#include "dd/advance_by.hpp"
 #include "dd/cached_iterator.hpp"
+#include "dd/prefetch_iterator.hpp"
+#include "dd/reserve_hint.hpp"
+#include "dd/segmented_range.hpp"
+#include "dd/slice_view_stats.hpp"
+#include "dd/stride_iterator.hpp"
 #include "dd/type_traits.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <concepts>
+#include <iterator>
+#include <limits>
 #include <ranges>
+#include <span>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace dd::ranges
 {
@@ -28,136 +41,1130 @@ template <typename T>
 concept const_copyable_or_movable =
   (std::is_const_v<std::remove_reference_t<T>> && std::copy_constructible<T>) ||
   std::move_constructible<T>;
+
+/**
+ * @brief Concept for objects that are not const-qualified.
+ */
+template <typename T>
+concept mutable_object = !std::is_const_v<std::remove_reference_t<T>>;
+
+/**
+ * @brief Concept for ranges where from-end indices are found by stepping backwards.
+ */
+template <typename R>
+concept steps_back_from_end =
+  std::ranges::bidirectional_range<R> && std::ranges::common_range<R>;
+
+/**
+ * @brief Resolves a slice index against the size of a range.
+ * @param index Index to resolve. Negative indices are counted from the end.
+ * @param size Size of the range.
+ * @return Index from the beginning of the range, clamped to [0, size].
+ */
+template <typename D>
+[[nodiscard]] constexpr auto resolve_index(D index, D size) noexcept -> D
+{
+  return index < 0 ? std::max(size + index, D{0}) : std::min(index, size);
+}
+
+/**
+ * @brief Advances an iterator by n elements, bounded by a sentinel.
+ * @details Advances through dd::ranges::advance_by, so iterators that can skip elements
+ * without visiting them do so. Returns the number of elements stepped over, which is
+ * recorded if DD_SLICE_VIEW_STATS is defined.
+ * @param iter The iterator to advance.
+ * @param n Number of elements to advance by. May be negative for bidirectional iterators.
+ * @param bound Bound of the iterator.
+ * @return The number of elements stepped over, in the direction of n.
+ */
+template <std::input_or_output_iterator I, std::sentinel_for<I> S>
+constexpr auto counted_advance(I& iter, std::iter_difference_t<I> n, S bound)
+  -> std::iter_difference_t<I>
+{
+  const auto advanced = n - dd::ranges::advance_by(iter, n, std::move(bound));
+  DD_SLICE_VIEW_STATS_ADVANCED(advanced < 0 ? -advanced : advanced);
+  return advanced;
+}
+
+/**
+ * @brief Advances an iterator to a sentinel.
+ * @details Equivalent to std::ranges::advance(iter, bound), but returns the number of
+ * elements stepped over, which is recorded if DD_SLICE_VIEW_STATS is defined.
+ * @param iter The iterator to advance.
+ * @param bound Sentinel to advance to.
+ * @return The number of elements stepped over.
+ */
+template <std::input_or_output_iterator I, std::sentinel_for<I> S>
+constexpr auto counted_advance(I& iter, S bound) -> std::iter_difference_t<I>
+{
+  auto advanced = std::iter_difference_t<I>{0};
+  if constexpr (std::sized_sentinel_for<S, I>)
+  {
+    advanced = bound - iter;
+    std::ranges::advance(iter, std::move(bound));
+  }
+  else
+  {
+    for (; iter != bound; ++iter)
+    {
+      ++advanced;
+    }
+  }
+  DD_SLICE_VIEW_STATS_ADVANCED(advanced);
+  return advanced;
+}
+
+/**
+ * @brief Advances an iterator by n elements, bounded by a sentinel.
+ * @details Equivalent to std::ranges::next(iter, n, bound), see counted_advance().
+ * @param iter The iterator to advance.
+ * @param n Number of elements to advance by. May be negative for bidirectional iterators.
+ * @param bound Bound of the iterator.
+ * @return The advanced iterator.
+ */
+template <std::input_or_output_iterator I, std::sentinel_for<I> S>
+[[nodiscard]] constexpr auto counted_next(I iter, std::iter_difference_t<I> n, S bound)
+  -> I
+{
+  counted_advance(iter, n, std::move(bound));
+  return iter;
+}
 } // namespace detail
 
+/**
+ * @brief Creates a slice index counted from the end of a range.
+ * @details Negative slice indices are counted from the end of the range, so from_end(n)
+ * is the index -n. As a special case, from_end(0) is the end of the range, which is
+ * represented by the maximum value of the index type.
+ * @param n Number of elements from the end of the range.
+ * @return The slice index.
+ */
+template <std::signed_integral I = std::ptrdiff_t>
+[[nodiscard]] constexpr auto from_end(std::type_identity_t<I> n) noexcept -> I
+{
+  assert(n >= 0);
+  return n == 0 ? std::numeric_limits<I>::max() : static_cast<I>(-n);
+}
+
+/**
+ * @brief Default policy for slice_view.
+ * @details A policy selects how a slice_view locates the ends of the slice. Custom
+ * policies should derive from this type and override only the members they change.
+ */
+struct slice_policy
+{
+  /**
+   * @brief Selects the lazy-sentinel mode.
+   * @details If false, end() returns an iterator advanced from the beginning of the
+   * slice to the ending index. If true, begin() returns a std::counted_iterator and end()
+   * returns a slice_sentinel, so the ending position is never walked to in advance.
+   */
+  static constexpr bool lazy_end = false;
+
+  /**
+   * @brief Selects strided slicing.
+   * @details If true, the slice takes a step argument and visits every step-th element
+   * of [start, end) with a stride_iterator.
+   */
+  static constexpr bool strided = false;
+
+  /**
+   * @brief Number of elements to prefetch ahead while iterating the slice.
+   * @details If non-zero, begin() and end() return prefetch_iterators that keep a lead
+   * iterator this many elements ahead and prefetch the elements under it. This only
+   * pays off for node-based ranges, such as std::list, whose nodes are scattered in
+   * memory, and when work is done on each element.
+   */
+  static constexpr std::size_t prefetch_distance = 0;
+
+  /**
+   * @brief Tag of the iterator caches, see non_propagating_cache.
+   * @details With concurrent_tag, a const slice_view can be iterated from several threads
+   * at once: the first thread locates and caches the iterators, and the others read
+   * them lock-free afterwards.
+   */
+  using cache_tag = sequential_tag;
+};
+
+/**
+ * @brief Policy for a slice_view whose end() is a counted sentinel.
+ */
+struct lazy_slice_policy : slice_policy
+{
+  static constexpr bool lazy_end = true;
+};
+
+/**
+ * @brief Policy for a slice_view that can be iterated concurrently.
+ */
+struct concurrent_slice_policy : slice_policy
+{
+  using cache_tag = concurrent_tag;
+};
+
+/**
+ * @brief Policy for a strided slice_view.
+ * @tparam Base The policy to add striding to.
+ */
+template <typename Base = slice_policy>
+struct strided_slice_policy : Base
+{
+  static constexpr bool strided = true;
+};
+
+/**
+ * @brief Policy for a slice_view that prefetches elements ahead while it is iterated.
+ * @tparam Distance Number of elements to prefetch ahead.
+ * @tparam Base The policy to add prefetching to.
+ */
+template <std::size_t Distance = 8, typename Base = slice_policy>
+struct prefetching_slice_policy : Base
+{
+  static constexpr std::size_t prefetch_distance = Distance;
+};
+
+/**
+ * @brief Sentinel for slice views in the lazy-sentinel mode.
+ * @details Compares equal to a std::counted_iterator once its count reaches zero, or
+ * once the underlying iterator reaches the end of the base range (for slices whose
+ * ending index is past the end of the base range).
+ * @tparam S The sentinel type of the base range.
+ */
+template <std::semiregular S>
+class slice_sentinel
+{
+public:
+  /**
+   * @brief Defaulted constructor.
+   */
+  slice_sentinel() = default;
+
+  /**
+   * @brief Constructor.
+   * @param end The sentinel of the base range.
+   */
+  constexpr explicit slice_sentinel(S end) : end_{std::move(end)} {}
+
+  /**
+   * @brief Gets the sentinel of the base range.
+   * @return Copy of the base sentinel.
+   */
+  [[nodiscard]] constexpr auto base() const -> S { return end_; }
+
+  /**
+   * @brief Checks if a counted iterator has reached the end of the slice.
+   * @param iter The counted iterator.
+   * @param sentinel The slice sentinel.
+   * @return True if the iterator is at the end of the slice, false otherwise.
+   */
+  template <std::input_or_output_iterator I>
+    requires std::sentinel_for<S, I>
+  [[nodiscard]] friend constexpr auto
+  operator==(std::counted_iterator<I> const& iter, slice_sentinel const& sentinel) -> bool
+  {
+    return iter.count() == 0 || iter.base() == sentinel.end_;
+  }
+
+  /**
+   * @brief Distance from a counted iterator to the end of the slice.
+   * @param sentinel The slice sentinel.
+   * @param iter The counted iterator.
+   * @return Number of elements remaining in the slice.
+   */
+  template <std::input_or_output_iterator I>
+    requires std::sized_sentinel_for<S, I>
+  [[nodiscard]] friend constexpr auto
+  operator-(slice_sentinel const& sentinel, std::counted_iterator<I> const& iter)
+    -> std::iter_difference_t<I>
+  {
+    return std::min(
+      iter.count(), static_cast<std::iter_difference_t<I>>(sentinel.end_ - iter.base()));
+  }
+
+  /**
+   * @brief Negative distance from a counted iterator to the end of the slice.
+   * @param iter The counted iterator.
+   * @param sentinel The slice sentinel.
+   * @return Negated number of elements remaining in the slice.
+   */
+  template <std::input_or_output_iterator I>
+    requires std::sized_sentinel_for<S, I>
+  [[nodiscard]] friend constexpr auto
+  operator-(std::counted_iterator<I> const& iter, slice_sentinel const& sentinel)
+    -> std::iter_difference_t<I>
+  {
+    return -(sentinel - iter);
+  }
+
+private:
+  S end_{};
+};
+
+/**
+ * @brief Front-based indices of a slice and the base iterators at those indices.
+ * @tparam I The iterator type of the base range.
+ * @tparam D The difference type of the base range.
+ */
+template <typename I, typename D>
+struct located_slice
+{
+  D start;
+  D end;
+  I first;
+  I last;
+};
+
+/**
+ * @brief Concept for objects that locate slices of a range, e.g. checkpoint_index.
+ * @details A slice locator provides a view R of its base range, e.g. a ref_view of
+ * the base it holds, and locates the iterators of a slice [start, end) of it. The
+ * located iterators must be valid for that view, since they seed the caches of a
+ * slice_view over it.
+ */
+template <typename L, typename R>
+concept slice_locator = requires(L& locator, std::ranges::range_difference_t<R> n) {
+  { locator.slice_base() } -> std::same_as<R>;
+  {
+    locator.locate_slice(n, n)
+  } -> std::same_as<
+    located_slice<std::ranges::iterator_t<R>, std::ranges::range_difference_t<R>>>;
+};
+
 /**
  * @brief A ranges slice view.
  * @details Implements a slice view that uses integral indices for the beginning and
- * ending of a range.
+ * ending of a range. Negative indices are counted from the end of the range (see
+ * from_end). For bidirectional common ranges, they are found by stepping backwards from
+ * the end of the range, which costs as many increments as the distance from the end.
+ * Otherwise they are resolved against the size of the range.
+ *
+ * Single-pass input ranges (e.g. std::views::istream or std::generator) are sliced by
+ * skipping the starting index once when begin() is called, and iterating with a
+ * std::counted_iterator that stops at the ending index without reading further. As for
+ * any input range, begin() may only be called once, and only on a non-const slice.
+ * Negative indices are only supported if the input range is sized.
+ *
+ * Copying or moving a slice copies or moves the base view and the indices only. The
+ * cached iterators and length are not propagated, and the caches are copied without
+ * allocating or throwing. Copying a slice is O(1) whenever copying the base view is,
+ * which std::ranges::view guarantees for copyable views, but the copy locates its
+ * iterators again when it is first iterated. A slice returns iterators of the base,
+ * which do not refer to the slice, so it is a borrowed range whenever the base is: a
+ * temporary slice of a std::span, std::ranges::subrange or std::ranges::iota_view can be
+ * passed to an algorithm without the result dangling.
+ * @tparam R The base range.
+ * @tparam Policy The slice policy, see slice_policy.
  */
-template <std::ranges::viewable_range R>
-class slice_view : public std::ranges::view_interface<slice_view<R>>
+template <std::ranges::viewable_range R, typename Policy = slice_policy>
+class slice_view : public std::ranges::view_interface<slice_view<R, Policy>>
 {
+  static_assert(
+    !(Policy::lazy_end && Policy::strided),
+    "The lazy-sentinel mode is not supported for strided slices.");
+  static_assert(
+    std::ranges::forward_range<R> || !Policy::strided,
+    "Strided slices require a forward range.");
+  static_assert(
+    Policy::prefetch_distance == 0 || !(Policy::lazy_end || Policy::strided),
+    "Prefetching is not supported for lazy-sentinel or strided slices.");
+  static_assert(
+    std::ranges::forward_range<R> || Policy::prefetch_distance == 0,
+    "Prefetching slices require a forward range.");
+
+public:
+  /**
+   * @brief Alias for the ranegs difference type.
+   */
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  /**
+   * @brief Alias for the slice policy.
+   */
+  using policy_type = Policy;
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  constexpr slice_view()
+    requires std::default_initializable<R>
+  = default;
+
+  /**
+   * @brief Constructor.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   */
+  constexpr slice_view(R base, difference_type start, difference_type end)
+      : base_{std::move(base)}, start_index_{start}, end_index_{end}
+  {
+    assert(start < 0 || end < 0 || end >= start);
+    assert(
+      std::ranges::forward_range<R> || std::ranges::sized_range<R> ||
+      (start >= 0 && (end >= 0 || to_end())));
+  }
+
+  /**
+   * @brief Constructor for strided slices.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   * @param step Number of elements between consecutive elements of the slice.
+   */
+  constexpr slice_view(
+    R base, difference_type start, difference_type end, difference_type step)
+    requires Policy::strided
+      : slice_view(std::move(base), start, end)
+  {
+    assert(step > 0);
+    step_ = step;
+  }
+
+  /**
+   * @brief Constructor from a slice locator.
+   * @details The slice locator finds the iterators of the slice, which seed the caches.
+   * The slice refers to the base of the locator, which must outlive it.
+   * @param locator The slice locator, e.g. a checkpoint_index of the base range.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   */
+  template <slice_locator<R> Locator>
+  constexpr slice_view(Locator& locator, difference_type start, difference_type end)
+      : slice_view(locator.slice_base(), locator.locate_slice(start, end))
+  {
+  }
+
+  /**
+   * @brief Constructor with pre-located iterators.
+   * @details The iterators seed the caches, so that the slice does not walk the base to
+   * find them. They are ignored if the iterators of R are not cached.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   * @param first Iterator of the base at the starting index.
+   * @param last Iterator of the base at the ending index.
+   */
+  constexpr slice_view(
+    R base,
+    difference_type start,
+    difference_type end,
+    std::ranges::iterator_t<R> first,
+    std::ranges::iterator_t<R> last)
+      : slice_view(std::move(base), start, end)
+  {
+    if constexpr (cacheable_range<R>)
+    {
+      begin_.emplace(std::move(first));
+      if constexpr (!Policy::lazy_end)
+      {
+        end_.emplace(std::move(last));
+      }
+    }
+  }
+
+  /**
+   * @brief Gets the underlying view.
+   * @param self Explicit object parameter (deducing this)
+   * @return A copy-constructed or move-constructed instance of the underlying view.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto base(this Self&& self) -> R
+    requires detail::const_copyable_or_movable<like_t<Self, R>>
+  {
+    return std::forward_like<Self>(self.base_);
+  }
+
+  /**
+   * @brief Gets the starting index of the slice.
+   * @return The starting index, as given to the constructor.
+   */
+  [[nodiscard]] constexpr auto start_index() const noexcept -> difference_type
+  {
+    return start_index_;
+  }
+
+  /**
+   * @brief Gets the ending index of the slice.
+   * @return The ending index, as given to the constructor.
+   */
+  [[nodiscard]] constexpr auto end_index() const noexcept -> difference_type
+  {
+    return end_index_;
+  }
+
+  /**
+   * @brief Gets an iterator to the beginning of the slice view.
+   * @param self Explicit object parameter (deducing this)
+   * @return Iterator to the beginning of the slice view. In the lazy-sentinel mode and
+   * for input ranges this is a std::counted_iterator over the base iterator, and for
+   * strided slices it is a stride_iterator. With a prefetch distance, it is a
+   * prefetch_iterator bounded by the end of the slice.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto begin(this Self&& self)
+    requires std::ranges::range<like_t<Self, R>> &&
+             (std::ranges::forward_range<R> || detail::mutable_object<Self>)
+  {
+    if constexpr (!std::ranges::forward_range<R>)
+    {
+      return std::counted_iterator{self.skip_to_begin(), self.lazy_count()};
+    }
+    else if constexpr (Policy::lazy_end)
+    {
+      return std::counted_iterator{self.find_begin(), self.lazy_count()};
+    }
+    else if constexpr (Policy::strided)
+    {
+      return stride_iterator{self.find_begin(), self.find_end(), self.step_};
+    }
+    else if constexpr (Policy::prefetch_distance > 0)
+    {
+      constexpr auto distance = static_cast<difference_type>(Policy::prefetch_distance);
+      return prefetch_iterator{self.find_begin(), self.find_end(), distance};
+    }
+    else
+    {
+      return self.find_begin();
+    }
+  }
+
+  /**
+   * @brief Gets an iterator to the end of the slice view.
+   * @details The ending iterator is advanced from the beginning of the slice, so calling
+   * end() first also locates and caches the beginning of the slice.
+   * @param self Explicit object parameter (deducing this)
+   * @return Iterator to the end of the slice view. In the lazy-sentinel mode and for
+   * input ranges this is a slice_sentinel and no elements are traversed.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto end(this Self&& self)
+    requires std::ranges::range<like_t<Self, R>> &&
+             (std::ranges::forward_range<R> || detail::mutable_object<Self>)
+  {
+    if constexpr (Policy::lazy_end || !std::ranges::forward_range<R>)
+    {
+      return slice_sentinel{std::ranges::end(self.base_)};
+    }
+    else if constexpr (Policy::strided)
+    {
+      auto last = self.find_end();
+      auto missing = difference_type{0};
+      if constexpr (std::ranges::random_access_range<like_t<Self, R>>)
+      {
+        // The number of elements missing from the last step is needed for constant time
+        // decrements and distances from the end.
+        const auto count = last - self.find_begin();
+        missing = (self.step_ - count % self.step_) % self.step_;
+      }
+      return stride_iterator{last, last, self.step_, missing};
+    }
+    else if constexpr (Policy::prefetch_distance > 0)
+    {
+      auto last = self.find_end();
+      return prefetch_iterator{last, last};
+    }
+    else
+    {
+      return self.find_end();
+    }
+  }
+
+  /**
+   * @brief Gets a reverse iterator to the last element of the slice view.
+   * @details The reverse iterator wraps the cached end of the slice, so that only the
+   * first call locates it, also for bases that are not common ranges. Unlike
+   * reverse_view, which keeps its own cache and locates the end again after being
+   * copied, repeated calls share the cache of this slice.
+   * @param self Explicit object parameter (deducing this)
+   * @return Reverse iterator to the last element of the slice view.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto rbegin(this Self&& self)
+    requires std::ranges::bidirectional_range<like_t<Self, R>> && (!Policy::lazy_end) &&
+             (!Policy::strided || std::ranges::random_access_range<like_t<Self, R>>)
+  {
+    if constexpr (Policy::strided)
+    {
+      return std::make_reverse_iterator(self.end());
+    }
+    else
+    {
+      return std::make_reverse_iterator(self.find_end());
+    }
+  }
+
+  /**
+   * @brief Gets a reverse iterator past the first element of the slice view.
+   * @param self Explicit object parameter (deducing this)
+   * @return Reverse iterator past the first element of the slice view, see rbegin().
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto rend(this Self&& self)
+    requires std::ranges::bidirectional_range<like_t<Self, R>> && (!Policy::lazy_end) &&
+             (!Policy::strided || std::ranges::random_access_range<like_t<Self, R>>)
+  {
+    if constexpr (Policy::strided)
+    {
+      return std::make_reverse_iterator(self.begin());
+    }
+    else
+    {
+      return std::make_reverse_iterator(self.find_begin());
+    }
+  }
+
+  /**
+   * @brief Gets the elements of the slice in reverse order.
+   * @details Returns a subrange of rbegin() and rend(), so the slice is located at most
+   * once, and iterating the result costs O(end - start) even for non-common bases.
+   * The subrange holds iterators of the base, so copies of it keep their positions, and
+   * it remains valid as long as the base does.
+   * @param self Explicit object parameter (deducing this)
+   * @return A subrange of the elements of the slice view, from last to first. It is
+   * sized if the base is.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto reversed(this Self&& self)
+    requires std::ranges::bidirectional_range<like_t<Self, R>> && (!Policy::lazy_end) &&
+             (!Policy::strided || std::ranges::random_access_range<like_t<Self, R>>)
+  {
+    if constexpr (std::ranges::sized_range<like_t<Self, R>>)
+    {
+      return std::ranges::subrange(self.rbegin(), self.rend(), self.size());
+    }
+    else
+    {
+      return std::ranges::subrange(self.rbegin(), self.rend());
+    }
+  }
+
+  /**
+   * @brief Gets the size of the sliced range.
+   * @param self Explicit object parameter (deducing this)
+   * @return Size of the range.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto size(this Self&& self)
+    requires std::ranges::sized_range<like_t<Self, R>>
+  {
+    constexpr auto zero = difference_type{0};
+    const auto base_size = static_cast<difference_type>(std::ranges::ssize(self.base_));
+    auto slice_size = std::max(
+      zero, detail::resolve_index(self.end_index_, base_size) -
+              detail::resolve_index(self.start_index_, base_size));
+    if constexpr (Policy::strided)
+    {
+      slice_size = (slice_size + self.step_ - 1) / self.step_;
+    }
+    return static_cast<std::make_unsigned_t<decltype(slice_size)>>(slice_size);
+  }
+
+  /**
+   * @brief Gets the size of a slice over a forward range that is not sized.
+   * @details The length of the slice is cached when the end of the slice is located by
+   * counting from its beginning, so after end() or the first call, size() is O(1).
+   * Otherwise, e.g. when the end was found by stepping back from the end of the base,
+   * the first call counts the elements of the slice. Like the cached iterators, the
+   * cached length is not propagated to copies.
+   * @param self Explicit object parameter (deducing this)
+   * @return Size of the range.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto size(this Self&& self)
+    requires std::ranges::forward_range<like_t<Self, R>> &&
+             (!std::ranges::sized_range<like_t<Self, R>>) && caches_size
+  {
+    auto last = self.find_end();
+    auto slice_size = self.size_.get_or_emplace(
+      [&] { return std::ranges::distance(self.find_begin(), last); });
+    if constexpr (Policy::strided)
+    {
+      slice_size = (slice_size + self.step_ - 1) / self.step_;
+    }
+    return static_cast<std::make_unsigned_t<difference_type>>(slice_size);
+  }
+
+  /**
+   * @brief Gets an upper bound of the size of the slice, without traversing the base.
+   * @details Like the C++26 std::ranges::reserve_hint, this never traverses the base,
+   * see dd::ranges::reserve_hint, even though slices of forward ranges are sized by
+   * counting their elements. It is the size of the slice for sized bases. Otherwise, it
+   * is the cached length once it is known, and the distance between the indices until
+   * then, clamped by the hint of the base past the starting index if the base provides
+   * one, as for the C++26 take_view. If an index is negative or the slice extends to the
+   * end of the base, no bound is known without traversing the base, and the hint is
+   * zero.
+   * @return The hint for the number of elements of the slice.
+   */
+  [[nodiscard]] constexpr auto reserve_hint() const
+    -> std::make_unsigned_t<difference_type>
+  {
+    if constexpr (std::ranges::sized_range<R const>)
+    {
+      return static_cast<std::make_unsigned_t<difference_type>>(size());
+    }
+    else
+    {
+      auto hint = difference_type{0};
+      if constexpr (caches_size)
+      {
+        if (size_.has_value())
+        {
+          hint = *size_;
+        }
+      }
+      if (hint == 0 && start_index_ >= 0 && end_index_ >= 0 && !to_end())
+      {
+        hint = std::max(end_index_ - start_index_, difference_type{0});
+        if constexpr (requires { dd::ranges::reserve_hint(base_); })
+        {
+          const auto base_hint =
+            static_cast<difference_type>(dd::ranges::reserve_hint(base_));
+          hint = std::min(hint, std::max(base_hint - start_index_, difference_type{0}));
+        }
+      }
+      if constexpr (Policy::strided)
+      {
+        hint = (hint + step_ - 1) / step_;
+      }
+      return static_cast<std::make_unsigned_t<difference_type>>(hint);
+    }
+  }
+
+  /**
+   * @brief Splits the slice into n consecutive sub-slices of balanced sizes.
+   * @details The boundaries of all sub-slices are found in a single sweep over the slice
+   * and seed the caches of the sub-slices, so that none of them walks the base again.
+   * Unless the base is sized, the length of the slice is counted by another sweep first.
+   * The sub-slices refer to the base of this slice, which must outlive them.
+   * @param self Explicit object parameter (deducing this)
+   * @param n Number of sub-slices.
+   * @return Vector of n sub-slices. The first (size() % n) sub-slices hold one more
+   * element than the others.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto split(this Self& self, std::size_t n)
+    requires std::ranges::forward_range<like_t<Self&, R>> && (!Policy::strided)
+  {
+    using base_type = std::remove_reference_t<like_t<Self&, R>>;
+    using piece_type = slice_view<std::ranges::ref_view<base_type>, Policy>;
+    assert(n > 0);
+
+    auto piece_begin = self.find_begin();
+    const auto length = [&]
+    {
+      if constexpr (std::ranges::sized_range<base_type>)
+      {
+        return static_cast<difference_type>(std::ranges::ssize(self));
+      }
+      else
+      {
+        return std::ranges::distance(piece_begin, self.find_end());
+      }
+    }();
+
+    const auto count = static_cast<difference_type>(n);
+    const auto quotient = length / count;
+    const auto remainder = length % count;
+    auto piece_start = self.from_front(self.start_index_);
+
+    auto pieces = std::vector<piece_type>{};
+    pieces.reserve(n);
+    for (auto k = difference_type{0}; k < count; ++k)
+    {
+      const auto piece_size = quotient + (k < remainder ? 1 : 0);
+      auto piece_end = std::ranges::next(piece_begin, piece_size);
+      pieces.emplace_back(
+        std::ranges::ref_view<base_type>(self.base_), piece_start,
+        piece_start + piece_size, std::move(piece_begin), piece_end);
+      piece_begin = std::move(piece_end);
+      piece_start += piece_size;
+    }
+    return pieces;
+  }
+
+  /**
+   * @brief Moves the bounds of the slice, reusing the cached iterators.
+   * @details Cached iterators are advanced from their current positions by the change of
+   * their indices, so moving the bounds of a slice over a forward range by k elements
+   * costs O(k) increments instead of walking from the beginning of the base. Bounds that
+   * move backwards are stepped back over bidirectional ranges. A cache is dropped, and
+   * located again when needed, if its index is negative, or if it moves backwards over a
+   * forward range or from past the end of the base.
+   * @param start New starting index of the slice.
+   * @param end New ending index of the slice.
+   */
+  constexpr auto set_bounds(difference_type start, difference_type end) -> void
+    requires std::ranges::forward_range<R>
+  {
+    assert(start < 0 || end < 0 || end >= start);
+    if constexpr (cacheable_range<R>)
+    {
+      const auto exact_begin = rebase(begin_, start_index_, start);
+      auto exact_end = false;
+      if constexpr (!Policy::lazy_end)
+      {
+        exact_end = rebase(end_, end_index_, end);
+      }
+      if constexpr (caches_size)
+      {
+        size_ = {};
+        // The length of a slice to the end of the base is not known from its indices.
+        constexpr auto max_index = std::numeric_limits<difference_type>::max();
+        if (exact_begin && exact_end && end != max_index)
+        {
+          record_length(end - start);
+        }
+      }
+    }
+    start_index_ = start;
+    end_index_ = end;
+  }
+
+  /**
+   * @brief Moves both bounds of the slice by k elements, see set_bounds().
+   * @details The indices must not be negative. The end of a slice to the end of the base
+   * (see from_end(0)) is kept.
+   * @param k Number of elements to move the slice by. May be negative for bidirectional
+   * ranges.
+   */
+  constexpr auto advance_window(difference_type k) -> void
+    requires std::ranges::forward_range<R>
+  {
+    assert(start_index_ >= 0 && end_index_ >= 0 && start_index_ + k >= 0);
+    set_bounds(start_index_ + k, to_end() ? end_index_ : end_index_ + k);
+  }
+
+  /**
+   * @brief Removes n elements from the front of the slice, see set_bounds().
+   * @details The starting index must not be negative, and does not move past a
+   * non-negative ending index.
+   * @param n Number of elements to remove.
+   */
+  constexpr auto shrink_front(difference_type n) -> void
+    requires std::ranges::forward_range<R>
+  {
+    assert(start_index_ >= 0 && n >= 0);
+    const auto start =
+      end_index_ >= 0 ? std::min(start_index_ + n, end_index_) : start_index_ + n;
+    set_bounds(start, end_index_);
+  }
+
+private:
+  /**
+   * @brief Moves a cached iterator from one index to another.
+   * @param cache The iterator cache.
+   * @param from The index of the cached iterator.
+   * @param to The new index of the cached iterator.
+   * @return True if the iterator is known to be exactly at the new index, i.e. it was
+   * not clamped to the end of the base. An iterator moved to from_end(0) is exactly at
+   * the end of the base.
+   */
+  template <typename Cache>
+  constexpr auto rebase(Cache& cache, difference_type from, difference_type to) -> bool
+  {
+    constexpr auto max_index = std::numeric_limits<difference_type>::max();
+    auto drop = [&]
+    {
+      cache = Cache{};
+      return false;
+    };
+    if (!cache.has_value())
+    {
+      return false;
+    }
+    if (from < 0 || to < 0 || from == max_index)
+    {
+      return from == to ? false : drop();
+    }
+
+    auto& iter = *cache;
+    const auto last = std::ranges::end(base_);
+    if (to == max_index)
+    {
+      detail::counted_advance(iter, last);
+      return true;
+    }
+    const auto delta = to - from;
+    if (delta >= 0)
+    {
+      const auto steps = detail::counted_advance(iter, delta, last);
+      return steps == delta && (delta != 0 || iter != last);
+    }
+    if constexpr (std::ranges::bidirectional_range<R>)
+    {
+      if (iter != last)
+      {
+        detail::counted_advance(iter, delta, std::ranges::begin(base_));
+        return true;
+      }
+    }
+    return drop();
+  }
+
+  /**
+   * @brief Constructor from a located slice.
+   * @param located The indices and iterators of the slice.
+   */
+  constexpr slice_view(
+    R base, located_slice<std::ranges::iterator_t<R>, difference_type> located)
+      : slice_view(
+          std::move(base), located.start, located.end, std::move(located.first),
+          std::move(located.last))
+  {
+  }
+
+  /**
+   * @brief Checks if the cached iterators can be used through an object of type Self.
+   * @details The caches hold iterators of R, so they are only used when iterating the
+   * base through Self yields the same iterator type (e.g. it is not used for a const
+   * owning_view, whose const iterators differ from the cached iterators).
+   */
+  template <typename Self>
+  static constexpr bool uses_cache =
+    cacheable_range<R> &&
+    std::same_as<std::ranges::iterator_t<like_t<Self, R>>, std::ranges::iterator_t<R>>;
+
+  /**
+   * @brief Checks if the length of the slice is cached.
+   * @details The length is cached for forward ranges that are not sized, where it is
+   * found as a by-product of locating the end of the slice.
+   */
+  static constexpr bool caches_size =
+    cacheable_range<R> && !std::ranges::sized_range<R> && !Policy::lazy_end;
+
+  /**
+   * @brief Caches the number of elements between the beginning and end of the slice.
+   * @param length The length of the slice.
+   */
+  constexpr auto record_length(difference_type length) const -> void
+  {
+    if constexpr (caches_size)
+    {
+      size_.get_or_emplace([&] { return length; });
+    }
+  }
+
+  /**
+   * @brief Checks if the ending index is the end of the base, see from_end(0).
+   * @return True if the slice extends to the end of the base.
+   */
+  [[nodiscard]] constexpr auto to_end() const noexcept -> bool
+  {
+    return end_index_ == std::numeric_limits<difference_type>::max();
+  }
 
-public:
   /**
-   * @brief Alias for the ranegs difference type.
+   * @brief Gets the number of elements in the base range.
+   * @param self Explicit object parameter (deducing this)
+   * @return Size of the base, found by traversing it if it is not sized.
    */
-  using difference_type = std::ranges::range_difference_t<R>;
+  template <typename Self>
+  [[nodiscard]] constexpr auto base_size(this Self& self) -> difference_type
+  {
+    if constexpr (std::ranges::sized_range<like_t<Self, R>>)
+    {
+      return static_cast<difference_type>(std::ranges::ssize(self.base_));
+    }
+    else
+    {
+      return std::ranges::distance(self.base_);
+    }
+  }
 
   /**
-   * @brief Defaulted constructor.
+   * @brief Resolves a from-end index against the size of the base.
+   * @param self Explicit object parameter (deducing this)
+   * @param index The index to resolve.
+   * @return The index counted from the beginning of the base.
    */
-  constexpr slice_view()
-    requires std::default_initializable<R>
-  = default;
+  template <typename Self>
+  [[nodiscard]] constexpr auto from_front(this Self& self, difference_type index)
+    -> difference_type
+  {
+    return index >= 0 ? index : std::max(self.base_size() + index, difference_type{0});
+  }
 
   /**
-   * @brief Constructor.
-   * @param start Starting index of the slice.
-   * @param end Ending index of the slice.
+   * @brief Gets the count of the counted iterator in the lazy-sentinel mode.
+   * @details The count may be larger than the number of remaining elements, since the
+   * slice_sentinel also stops at the end of the base range.
+   * @param self Explicit object parameter (deducing this)
+   * @return The number of elements between the starting and ending indices.
    */
-  constexpr slice_view(R base, difference_type start, difference_type end)
-      : base_{std::move(base)}, start_index_{start}, end_index_{end}
+  template <typename Self>
+  [[nodiscard]] constexpr auto lazy_count(this Self& self) -> difference_type
   {
-    assert(start >= 0);
-    assert(end >= 0);
-    assert(end >= start);
+    if (self.start_index_ >= 0 && self.end_index_ >= 0)
+    {
+      return std::max(self.end_index_ - self.start_index_, difference_type{0});
+    }
+    if (self.to_end())
+    {
+      return std::numeric_limits<difference_type>::max();
+    }
+    return std::max(
+      self.from_front(self.end_index_) - self.from_front(self.start_index_),
+      difference_type{0});
   }
 
   /**
-   * @brief Gets the underlying view.
+   * @brief Gets the base iterator at the starting index.
+   * @details If caching is used, the iterator is cached and reused by later calls.
    * @param self Explicit object parameter (deducing this)
-   * @return A copy-constructed or move-constructed instance of the underlying view.
+   * @return The base iterator at the starting index, clamped to the end of the base. If
+   * caching is used, this is a reference to the cached iterator, so that callers which
+   * only compare or measure against it do not copy it.
    */
   template <typename Self>
-  [[nodiscard]] constexpr auto base(this Self&& self) -> R
-    requires detail::const_copyable_or_movable<like_t<Self, R>>
+  [[nodiscard]] constexpr auto find_begin(this Self& self) -> decltype(auto)
   {
-    return std::forward_like<Self>(self.base_);
+    if constexpr (uses_cache<Self>)
+    {
+      return self.begin_.get_or_emplace([&] { return self.locate_begin(); });
+    }
+    else
+    {
+      return self.locate_begin();
+    }
   }
 
   /**
-   * @brief Gets an iterator to the beginning of the slice view.
+   * @brief Gets the base iterator at the ending index.
+   * @details If caching is used, the iterator is cached and reused by later calls.
    * @param self Explicit object parameter (deducing this)
-   * @return Iterator to the beginning of the slice view.
+   * @return The base iterator at the ending index, clamped to the end of the base, or a
+   * reference to the cached iterator, see find_begin().
    */
   template <typename Self>
-  [[nodiscard]] constexpr auto begin(this Self&& self)
-    requires std::ranges::range<like_t<Self, R>>
+  [[nodiscard]] constexpr auto find_end(this Self& self) -> decltype(auto)
   {
-    return self.next(self.begin_, self.start_index_);
+    if constexpr (uses_cache<Self> && !Policy::lazy_end)
+    {
+      return self.end_.get_or_emplace([&] { return self.locate_end(); });
+    }
+    else
+    {
+      return self.locate_end();
+    }
   }
 
   /**
-   * @brief Gets an iterator to the beginning of the slice view.
+   * @brief Skips to the starting index of a slice over an input range.
+   * @details The base is read up to the starting index, so this may only be called once.
    * @param self Explicit object parameter (deducing this)
-   * @return Iterator to the beginning of the slice view.
+   * @return The base iterator at the starting index, clamped to the end of the base.
    */
   template <typename Self>
-  [[nodiscard]] constexpr auto end(this Self&& self)
-    requires std::ranges::range<like_t<Self, R>>
+  [[nodiscard]] constexpr auto skip_to_begin(this Self& self)
   {
-    return self.next(self.end_, self.end_index_);
+    auto first = std::ranges::begin(self.base_);
+    detail::counted_advance(
+      first, self.from_front(self.start_index_), std::ranges::end(self.base_));
+    return first;
   }
 
   /**
-   * @brief Gets the size of the sliced range.
+   * @brief Locates the base iterator at the starting index.
+   * @details The begin iterator from the base range is advanced by the starting index.
    * @param self Explicit object parameter (deducing this)
-   * @return Size of the range.
+   * @return The base iterator at the starting index, clamped to the end of the base.
    */
   template <typename Self>
-  [[nodiscard]] constexpr auto size(this Self&& self)
-    requires std::ranges::sized_range<like_t<Self, R>>
+  [[nodiscard]] constexpr auto locate_begin(this Self& self)
   {
-    constexpr auto zero = difference_type{0};
-    const auto base_size = std::ranges::ssize(self.base_);
-    auto slice_size = std::max(
-      zero, std::clamp(self.end_index_, zero, base_size) -
-              std::clamp(self.start_index_, zero, base_size));
-    return static_cast<std::make_unsigned_t<decltype(slice_size)>>(slice_size);
+    auto first = std::ranges::begin(self.base_);
+    auto last = std::ranges::end(self.base_);
+    if (self.start_index_ >= 0)
+    {
+      return detail::counted_next(std::move(first), self.start_index_, std::move(last));
+    }
+    if constexpr (detail::steps_back_from_end<like_t<Self, R>>)
+    {
+      return detail::counted_next(std::move(last), self.start_index_, std::move(first));
+    }
+    else
+    {
+      return detail::counted_next(
+        std::move(first), self.from_front(self.start_index_), std::move(last));
+    }
   }
 
-private:
   /**
-   * @brief Get the next iterator advanced by n elements.
-   * @details The begin iterator from the base range will be advanced by n elements. If
-   * caching is used, the iterator will also be cached and reused for repeated calls to
-   * next.
-   * @param iter A cached iterator or an empty type.
-   * @param n number of elements to advance.
-   * @return The resulting iterator advanced by n elements.
-   * @note The argument cached_iter is a template because it may be either
-   * cached_iterator or an empty type. The empty types need to be distinct empty types
-   * in order for [[no_unique_address]] to work properly. This is the reason for the
-   * template: the cached begin and end iterators are distinct empty types when
-   * is_cached_iterator_ is false.
-   */
-  [[nodiscard]] constexpr auto next(auto& iter, difference_type n) const
+   * @brief Locates the base iterator at the ending index.
+   * @details Rather than walking from the beginning of the base range, the iterator at
+   * the starting index is advanced by the remaining index count. Locating both ends of
+   * a slice over a forward range therefore costs end_index_ increments in total. A
+   * negative ending index is found by stepping back from the end of the base, bounded by
+   * the beginning of the slice. When the end is found by counting from the beginning of
+   * the slice, the length of the slice is cached as well.
+   * @param self Explicit object parameter (deducing this)
+   * @return The base iterator at the ending index, clamped to the end of the base.
+   */
+  template <typename Self>
+  [[nodiscard]] constexpr auto locate_end(this Self& self)
   {
-    if constexpr (cacheable_range<R>)
+    auto iter = self.find_begin();
+    auto last = std::ranges::end(self.base_);
+    if (self.to_end())
+    {
+      self.record_length(detail::counted_advance(iter, last));
+    }
+    else if (self.start_index_ >= 0 && self.end_index_ >= 0)
+    {
+      self.record_length(detail::counted_advance(
+        iter, std::max(self.end_index_ - self.start_index_, difference_type{0}), last));
+    }
+    else if constexpr (detail::steps_back_from_end<like_t<Self, R>>)
     {
-      if (iter.has_value())
+      if (self.end_index_ < 0)
+      {
+        // The length is not known when stepping back, so size() counts it if needed.
+        iter = detail::counted_next(std::move(last), self.end_index_, std::move(iter));
+      }
+      else
       {
-        return iter.value();
+        // The starting index is counted from the end, so walk from the beginning of the
+        // base until either the ending index or the beginning of the slice is reached.
+        auto pos = std::ranges::begin(self.base_);
+        const auto remaining =
+          self.end_index_ - detail::counted_advance(pos, self.end_index_, iter);
+        self.record_length(
+          remaining == 0 ? 0 : detail::counted_advance(iter, remaining, last));
       }
     }
-
-    auto next_iter =
-      std::ranges::next(std::ranges::begin(base_), n, std::ranges::end(base_));
-    if constexpr (cacheable_range<R>)
+    else
     {
-      iter.emplace(next_iter);
+      self.record_length(detail::counted_advance(
+        iter,
+        std::max(
+          self.from_front(self.end_index_) - self.from_front(self.start_index_),
+          difference_type{0}),
+        last));
     }
-    return next_iter;
+    return iter;
   }
 
   R base_{};
   difference_type start_index_{0};
   difference_type end_index_{0};
+  [[no_unique_address]] maybe_present_t<
+    Policy::strided,
+    difference_type,
+    DD_UNIQUE_EMPTY_TYPE> step_{1};
 
-  [[no_unique_address]] mutable maybe_cached_iterator_t<R> begin_;
-  [[no_unique_address]] mutable maybe_cached_iterator_t<R> end_;
+  // Note: The empty types need to be distinct empty types in order for
+  // [[no_unique_address]] to work properly, which is why each cache spells out its own
+  // unique empty type. The ending iterator is never cached in the lazy-sentinel mode.
+  [[no_unique_address]] mutable maybe_cached_iterator_t<
+    R,
+    DD_UNIQUE_EMPTY_TYPE,
+    typename Policy::cache_tag> begin_;
+  [[no_unique_address]] mutable maybe_present_t<
+    cacheable_range<R> && !Policy::lazy_end,
+    cached_iterator_t<R, typename Policy::cache_tag>,
+    DD_UNIQUE_EMPTY_TYPE> end_;
+  [[no_unique_address]] mutable maybe_present_t<
+    caches_size,
+    non_propagating_cache<difference_type, typename Policy::cache_tag>,
+    DD_UNIQUE_EMPTY_TYPE> size_;
 };
 
 /**
@@ -168,23 +1175,261 @@ template <typename R>
 slice_view(R&&, std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>)
   -> slice_view<std::views::all_t<R>>;
 
+/**
+ * @brief Deduction guide for slice_view from a slice locator.
+ */
+template <typename L>
+  requires slice_locator<L, decltype(std::declval<L&>().slice_base())>
+slice_view(L&, typename L::difference_type, typename L::difference_type)
+  -> slice_view<decltype(std::declval<L&>().slice_base())>;
+
+/**
+ * @brief Deduction guide for strided slice_view.
+ * @details Wraps the input range type in std::views::all_t.
+ */
+template <typename R>
+slice_view(
+  R&&,
+  std::ranges::range_difference_t<R>,
+  std::ranges::range_difference_t<R>,
+  std::ranges::range_difference_t<R>)
+  -> slice_view<std::views::all_t<R>, strided_slice_policy<>>;
+
+namespace detail
+{
+template <typename T>
+inline constexpr bool is_slice_view = false;
+
+template <typename R, typename Policy>
+inline constexpr bool is_slice_view<slice_view<R, Policy>> = true;
+
+template <typename T>
+inline constexpr bool is_drop_view = false;
+
+template <typename V>
+inline constexpr bool is_drop_view<std::ranges::drop_view<V>> = true;
+
+template <typename T>
+inline constexpr bool is_take_view = false;
+
+template <typename V>
+inline constexpr bool is_take_view<std::ranges::take_view<V>> = true;
+
+template <typename T>
+inline constexpr bool is_iota_view = false;
+
+template <typename W, typename Bound>
+inline constexpr bool is_iota_view<std::ranges::iota_view<W, Bound>> = true;
+
+template <typename T>
+inline constexpr bool is_subrange = false;
+
+template <typename I, typename S, std::ranges::subrange_kind K>
+inline constexpr bool is_subrange<std::ranges::subrange<I, S, K>> = true;
+
+/**
+ * @brief Concept for slices, drop views and take views whose base can be sliced instead.
+ * @details Slices of strided slices are not fused. Slices of unsized input ranges are not
+ * fused either, since resolving their indices could consume the elements. Drop and take
+ * views must be sized, since their counts are only observable through their sizes.
+ */
+template <typename R>
+concept fusable_adaptor =
+  requires(R&& r) { std::forward<R>(r).base(); } &&
+  ((is_slice_view<std::remove_cvref_t<R>> &&
+    !std::remove_cvref_t<R>::policy_type::strided &&
+    (std::ranges::forward_range<decltype(std::declval<R>().base())> ||
+     std::ranges::sized_range<decltype(std::declval<R>().base())>)) ||
+   ((is_drop_view<std::remove_cvref_t<R>> || is_take_view<std::remove_cvref_t<R>>) &&
+    std::ranges::sized_range<R> &&
+    std::ranges::sized_range<decltype(std::declval<R>().base())>));
+
+/**
+ * @brief Concept for policies under which segmented ranges are sliced by segment.
+ * @details A segmented_slice_view has a sequential cache and plain iterators, so it is
+ * only used for policies that neither make the slice lazy or strided, nor ask for a
+ * concurrent cache or for prefetching.
+ */
+template <typename Policy>
+concept segmented_slice_policy =
+  !Policy::lazy_end && !Policy::strided && Policy::prefetch_distance == 0 &&
+  std::same_as<typename Policy::cache_tag, sequential_tag>;
+
+/**
+ * @brief Concept for iota views and subranges that are sliced into their own type.
+ */
+template <typename R>
+concept fusable_random_access =
+  (is_iota_view<std::remove_cvref_t<R>> || is_subrange<std::remove_cvref_t<R>>) &&
+  std::ranges::random_access_range<R> && std::ranges::sized_range<R>;
+
+/**
+ * @brief Adds two non-negative indices, saturating at the maximum index.
+ * @details The maximum index denotes the end of a range, see from_end.
+ */
+template <typename D>
+[[nodiscard]] constexpr auto saturating_add(D x, D y) noexcept -> D
+{
+  return x > std::numeric_limits<D>::max() - y ? std::numeric_limits<D>::max() : x + y;
+}
+
+/**
+ * @brief Combines the slice [start, end) of a window into indices of the window's base.
+ * @param offset Index of the first element of the window in its base.
+ * @param length Number of elements in the window.
+ * @param start Starting index of the slice of the window.
+ * @param end Ending index of the slice of the window.
+ * @return Starting and ending indices into the base of the window.
+ */
+template <typename D>
+[[nodiscard]] constexpr auto
+combine_indices(D offset, D length, D start, D end) noexcept -> std::pair<D, D>
+{
+  const auto first = resolve_index(start, length);
+  const auto last = std::max(resolve_index(end, length), first);
+  return {offset + first, offset + last};
+}
+
+/**
+ * @brief Combines non-negative slice indices of a slice into indices of its base.
+ * @details No sizes are needed, since both slices are counted from the beginning of
+ * the base. Clamping to the size of the base is left to the slice of the base.
+ * @param inner_start Starting index of the inner slice.
+ * @param inner_end Ending index of the inner slice.
+ * @param start Starting index of the outer slice.
+ * @param end Ending index of the outer slice.
+ * @return Starting and ending indices into the base of the inner slice.
+ */
+template <typename D>
+[[nodiscard]] constexpr auto combine_front_indices(
+  D inner_start, D inner_end, D start, D end) noexcept -> std::pair<D, D>
+{
+  const auto first = saturating_add(inner_start, start);
+  const auto last = end == std::numeric_limits<D>::max()
+                      ? inner_end
+                      : std::min(saturating_add(inner_start, end), inner_end);
+  return {first, std::max(last, first)};
+}
+} // namespace detail
+
+/**
+ * @brief Traits of contiguous ranges that are notified of their span slices.
+ * @details A specialization provides a static member function advise(span), which the
+ * slice adaptor calls at run time with every std::span it slices from the range, e.g.
+ * so that mapped_records asks the kernel to page in exactly the sliced bytes. The
+ * primary template is not notified.
+ * @tparam R The range type, without cv or reference qualifiers.
+ */
+template <typename R>
+struct span_slice_traits
+{
+};
+
+namespace detail
+{
+/**
+ * @brief Concept for ranges whose span_slice_traits are notified of their span slices.
+ */
+template <typename R, typename Span>
+concept advises_span_slices = requires(Span span) {
+  span_slice_traits<std::remove_cvref_t<R>>::advise(span);
+};
+} // namespace detail
+
 namespace views
 {
 namespace detail
 {
-template <typename R>
+template <typename R, typename Policy>
 concept can_slice_view = requires {
-  slice_view(
-    std::declval<R>(), std::declval<std::ranges::range_difference_t<R>>(),
+  slice_view<std::views::all_t<R>, Policy>(
+    std::views::all(std::declval<R>()),
+    std::declval<std::ranges::range_difference_t<R>>(),
     std::declval<std::ranges::range_difference_t<R>>());
 };
 
+/**
+ * @brief Converts an adaptor index to the difference type of the sliced range.
+ * @details The maximum value of the index type (see from_end(0)) is converted to the
+ * maximum value of the difference type, so that it keeps denoting the end of the range.
+ * @param index The index to convert.
+ * @return The converted index.
+ */
+template <std::integral D, std::integral I>
+[[nodiscard]] constexpr auto to_difference(I index) noexcept -> D
+{
+  if (index == std::numeric_limits<I>::max())
+  {
+    return std::numeric_limits<D>::max();
+  }
+  return static_cast<D>(index);
+}
+
+/**
+ * @brief Concept for ranges that the slice adaptor collapses to a std::span.
+ * @details The range must be contiguous and sized, and must be borrowed so that the
+ * resulting span cannot outlive the elements it refers to. Policies that change the
+ * iterator type of the slice are never collapsed, except prefetching, which does not pay
+ * off for contiguous elements.
+ */
+template <typename R, typename Policy>
+concept span_sliceable = std::ranges::contiguous_range<R> &&
+                         std::ranges::sized_range<R> &&
+                         std::ranges::borrowed_range<R> && !Policy::lazy_end &&
+                         !Policy::strided;
+
+/**
+ * @brief Slices a contiguous range into a std::span.
+ * @details The indices are clamped in the same way as slice_view clamps them. Ranges
+ * with span_slice_traits are notified of the span.
+ * @param r The contiguous range to slice.
+ * @param start Starting index of the slice.
+ * @param end Ending index of the slice.
+ * @return A span over the elements [start, end) of the range.
+ */
+template <std::ranges::contiguous_range R>
+  requires std::ranges::sized_range<R>
+[[nodiscard]] constexpr auto make_span_slice(
+  R&& r,
+  std::ranges::range_difference_t<R> start,
+  std::ranges::range_difference_t<R> end)
+{
+  using difference_type = std::ranges::range_difference_t<R>;
+  using element_type = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+
+  const auto base_size = static_cast<difference_type>(std::ranges::ssize(r));
+  const auto first = dd::ranges::detail::resolve_index(start, base_size);
+  const auto last = std::max(dd::ranges::detail::resolve_index(end, base_size), first);
+  auto span = std::span<element_type>(
+    std::ranges::data(r) + first, static_cast<std::size_t>(last - first));
+  if constexpr (ranges::detail::advises_span_slices<R, std::span<element_type>>)
+  {
+    if !consteval
+    {
+      span_slice_traits<std::remove_cvref_t<R>>::advise(span);
+    }
+  }
+  return span;
+}
+
 /**
  * @brief Range adaptor closure for @c slice_view.
+ * @details Contiguous, sized and borrowed ranges (e.g. l-value std::vector, std::array
+ * or std::span) are sliced into a std::span instead of a slice_view. The span is a
+ * trivially copyable pointer and size, and iterates with raw pointers.
+ *
+ * Slicing a slice_view, or a sized drop_view or take_view, slices the underlying base
+ * with combined indices instead of nesting views. Slicing a sized random access iota_view
+ * or subrange returns a narrowed view of the same kind.
+ *
+ * Segmented ranges (see segmented_range, e.g. a join_view of vectors) are sliced into a
+ * segmented_slice_view, which skips whole segments when it is first iterated, unless
+ * the policy asks for a lazy, strided, concurrent or prefetching slice_view.
  */
-template <std::integral DifferenceType>
+template <std::integral DifferenceType, typename Policy = slice_policy>
 class slice_range_adaptor
-    : public std::ranges::range_adaptor_closure<slice_range_adaptor<DifferenceType>>
+    : public std::ranges::range_adaptor_closure<
+        slice_range_adaptor<DifferenceType, Policy>>
 {
 public:
   /*
@@ -197,25 +1442,156 @@ public:
   {
   }
 
+  /*
+   * @brief Constructor for strided slices.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   * @param step Number of elements between consecutive elements of the slice.
+   */
+  constexpr slice_range_adaptor(
+    DifferenceType start, DifferenceType end, DifferenceType step)
+    requires Policy::strided
+      : start_{start}, end_{end}, step_{step}
+  {
+  }
+
   /**
    * @brief Required operator for range_adaptor_closure.
    * @param range The range to slice.
-   * @return A slice view.
+   * @return A std::span for contiguous borrowed ranges, a fused view for the ranges
+   * described above, otherwise a slice view.
    */
   template <std::ranges::viewable_range R>
   [[nodiscard]] constexpr auto operator()(R&& r) const
-    requires detail::can_slice_view<R>
+    requires detail::can_slice_view<R, Policy>
   {
-    return slice_view(
-      std::forward<R>(r), static_cast<std::ranges::range_difference_t<R>>(start_),
-      static_cast<std::ranges::range_difference_t<R>>(end_));
+    using difference_type = std::ranges::range_difference_t<R>;
+    const auto start = detail::to_difference<difference_type>(start_);
+    const auto end = detail::to_difference<difference_type>(end_);
+
+    if constexpr (detail::span_sliceable<R, Policy>)
+    {
+      return detail::make_span_slice(r, start, end);
+    }
+    else if constexpr (!Policy::strided && ranges::detail::fusable_random_access<R>)
+    {
+      auto first = std::ranges::begin(r);
+      const auto [lo, hi] = ranges::detail::combine_indices(
+        difference_type{0}, static_cast<difference_type>(std::ranges::ssize(r)), start,
+        end);
+      if constexpr (ranges::detail::is_subrange<std::remove_cvref_t<R>>)
+      {
+        return std::ranges::subrange(first + lo, first + hi);
+      }
+      else
+      {
+        return std::ranges::iota_view(*(first + lo), *(first + hi));
+      }
+    }
+    else if constexpr (
+      ranges::detail::segmented_slice_policy<Policy> && ranges::segmented_range<R>)
+    {
+      return ranges::detail::make_segmented_slice(std::forward<R>(r), start, end);
+    }
+    else if constexpr (!Policy::strided && ranges::detail::fusable_adaptor<R>)
+    {
+      return fuse(std::forward<R>(r), start, end);
+    }
+    else if constexpr (Policy::strided)
+    {
+      return slice_view<std::views::all_t<R>, Policy>(
+        std::views::all(std::forward<R>(r)), start, end,
+        static_cast<difference_type>(step_));
+    }
+    else
+    {
+      return slice_view<std::views::all_t<R>, Policy>(
+        std::views::all(std::forward<R>(r)), start, end);
+    }
   }
 
 private:
+  /**
+   * @brief Slices the base of a slice_view, drop_view or take_view.
+   * @param r The range to slice.
+   * @param start Starting index of the slice of r.
+   * @param end Ending index of the slice of r.
+   * @return The slice of the base of r.
+   */
+  template <ranges::detail::fusable_adaptor R>
+  [[nodiscard]] static constexpr auto fuse(
+    R&& r,
+    std::ranges::range_difference_t<R> start,
+    std::ranges::range_difference_t<R> end)
+  {
+    using view_type = std::remove_cvref_t<R>;
+    using difference_type = std::ranges::range_difference_t<R>;
+
+    auto slice_base = [](auto base, std::pair<difference_type, difference_type> indices)
+    {
+      using base_difference = std::ranges::range_difference_t<decltype(base)>;
+      return slice_range_adaptor<base_difference, Policy>{
+        static_cast<base_difference>(indices.first),
+        static_cast<base_difference>(indices.second)}(std::move(base));
+    };
+
+    if constexpr (ranges::detail::is_slice_view<view_type>)
+    {
+      const auto inner_start = r.start_index();
+      const auto inner_end = r.end_index();
+      if constexpr (std::ranges::sized_range<decltype(std::forward<R>(r).base())>)
+      {
+        const auto length = static_cast<difference_type>(std::ranges::ssize(r));
+        auto base = std::forward<R>(r).base();
+        const auto offset = ranges::detail::resolve_index(
+          inner_start, static_cast<difference_type>(std::ranges::ssize(base)));
+        return slice_base(
+          std::move(base),
+          ranges::detail::combine_indices(offset, length, start, end));
+      }
+      else
+      {
+        auto base = std::forward<R>(r).base();
+        if (inner_start >= 0 && inner_end >= 0 && start >= 0 && end >= 0)
+        {
+          return slice_base(
+            std::move(base), ranges::detail::combine_front_indices(
+                               inner_start, inner_end, start, end));
+        }
+
+        // From-end indices of an unsized forward base are resolved against its distance
+        // when the adaptor is applied, which the nested slices would walk when iterated.
+        const auto base_size = std::ranges::distance(base);
+        const auto offset = ranges::detail::resolve_index(inner_start, base_size);
+        const auto length = std::max(
+          ranges::detail::resolve_index(inner_end, base_size) - offset,
+          difference_type{0});
+        return slice_base(
+          std::move(base),
+          ranges::detail::combine_indices(offset, length, start, end));
+      }
+    }
+    else
+    {
+      // The counts of drop and take views are observable only through their sizes.
+      const auto length = static_cast<difference_type>(std::ranges::ssize(r));
+      auto base = std::forward<R>(r).base();
+      auto offset = difference_type{0};
+      if constexpr (ranges::detail::is_drop_view<view_type>)
+      {
+        offset = static_cast<difference_type>(std::ranges::ssize(base)) - length;
+      }
+      return slice_base(
+        std::move(base), ranges::detail::combine_indices(offset, length, start, end));
+    }
+  }
+
   DifferenceType start_;
   DifferenceType end_;
+  [[no_unique_address]] maybe_present_t<Policy::strided, DifferenceType> step_{1};
 };
 
+template <typename Policy = slice_policy>
 struct slice_fn
 {
   /**
@@ -224,21 +1600,145 @@ struct slice_fn
    * @param end Ending index of the slice.
    * @return A slice range adaptor object.
    */
-  template <std::integral DifferenceType>
-  [[nodiscard]] constexpr auto operator()(DifferenceType start, DifferenceType end) const
-    -> slice_range_adaptor<DifferenceType>
+  template <std::integral Start, std::integral End>
+  [[nodiscard]] constexpr auto operator()(Start start, End end) const
+    -> slice_range_adaptor<std::common_type_t<Start, End>, Policy>
+  {
+    using difference_type = std::common_type_t<Start, End>;
+    return slice_range_adaptor<difference_type, Policy>{
+      detail::to_difference<difference_type>(start),
+      detail::to_difference<difference_type>(end)};
+  }
+
+  /**
+   * @brief Constructs and returns a strided slice range adaptor.
+   * @param start Starting index of the slice.
+   * @param end Ending index of the slice.
+   * @param step Number of elements between consecutive elements of the slice.
+   * @return A slice range adaptor object.
+   */
+  template <std::integral Start, std::integral End, std::integral Step>
+  [[nodiscard]] constexpr auto operator()(Start start, End end, Step step) const
+    -> slice_range_adaptor<
+      std::common_type_t<Start, End, Step>,
+      strided_slice_policy<Policy>>
+    requires(!Policy::lazy_end)
+  {
+    using difference_type = std::common_type_t<Start, End, Step>;
+    return slice_range_adaptor<difference_type, strided_slice_policy<Policy>>{
+      detail::to_difference<difference_type>(start),
+      detail::to_difference<difference_type>(end), static_cast<difference_type>(step)};
+  }
+};
+
+/**
+ * @brief The compile-time extent of arrays and static-extent spans.
+ */
+template <typename R>
+inline constexpr std::size_t static_extent = std::dynamic_extent;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t static_extent<T[N]> = N;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t static_extent<std::array<T, N>> = N;
+
+template <typename T, std::size_t N>
+inline constexpr std::size_t static_extent<std::span<T, N>> = N;
+
+/**
+ * @brief Concept for ranges that slice_c slices into a static-extent std::span.
+ */
+template <typename R>
+concept static_span_sliceable =
+  std::ranges::contiguous_range<R> && std::ranges::borrowed_range<R> &&
+  static_extent<std::remove_cvref_t<R>> != std::dynamic_extent;
+
+/**
+ * @brief Range adaptor closure for slices with compile-time indices, see slice_c.
+ * @tparam Start Starting index of the slice.
+ * @tparam End Ending index of the slice.
+ */
+template <std::ptrdiff_t Start, std::ptrdiff_t End>
+class static_slice_range_adaptor
+    : public std::ranges::range_adaptor_closure<static_slice_range_adaptor<Start, End>>
+{
+public:
+  /**
+   * @brief Required operator for range_adaptor_closure.
+   * @details The indices are resolved against the static extent at compile time, and
+   * must lie within it. Ranges without a static extent are sliced by the slice adaptor.
+   * @param range The range to slice.
+   * @return A std::span with the static extent End - Start for borrowed arrays and
+   * static-extent spans, otherwise the result of dd::views::slice(Start, End).
+   */
+  template <std::ranges::viewable_range R>
+  [[nodiscard]] constexpr auto operator()(R&& r) const
   {
-    return slice_range_adaptor{start, end};
+    if constexpr (static_span_sliceable<R>)
+    {
+      using element_type = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+      constexpr auto size =
+        static_cast<std::ptrdiff_t>(static_extent<std::remove_cvref_t<R>>);
+      constexpr auto to_end = End == std::numeric_limits<std::ptrdiff_t>::max();
+      constexpr auto first = Start < 0 ? size + Start : Start;
+      constexpr auto last = to_end ? size : (End < 0 ? size + End : End);
+      static_assert(
+        0 <= first && first <= last && last <= size,
+        "The slice is out of the bounds of the static extent.");
+      return std::span<element_type, static_cast<std::size_t>(last - first)>(
+        std::ranges::data(r) + first, static_cast<std::size_t>(last - first));
+    }
+    else
+    {
+      return slice_fn<>{}(Start, End)(std::forward<R>(r));
+    }
   }
 };
 } // namespace detail
 
-inline constexpr auto slice = detail::slice_fn{};
+inline constexpr auto slice = detail::slice_fn<>{};
+
+/**
+ * @brief Slice adaptor with a custom slice policy, see slice_policy.
+ */
+template <typename Policy>
+inline constexpr auto slice_with = detail::slice_fn<Policy>{};
+
+/**
+ * @brief Slice adaptor in the lazy-sentinel mode, see lazy_slice_policy.
+ */
+inline constexpr auto lazy_slice = slice_with<lazy_slice_policy>;
+
+/**
+ * @brief Slice adaptor with compile-time indices.
+ * @details Slices of borrowed arrays and static-extent spans are std::spans with the
+ * static extent End - Start, which store no indices and are bounds checked at compile
+ * time. Other ranges are sliced as by dd::views::slice(Start, End).
+ * @tparam Start Starting index of the slice.
+ * @tparam End Ending index of the slice, or from_end(0) for the end of the range.
+ */
+template <std::ptrdiff_t Start, std::ptrdiff_t End>
+inline constexpr auto slice_c = detail::static_slice_range_adaptor<Start, End>{};
 
 } // namespace views
 } // namespace dd::ranges
 
+namespace std::ranges
+{
+/**
+ * @brief A slice_view is a borrowed range if its base is, since its iterators are
+ * iterators of the base.
+ */
+template <typename R, typename Policy>
+inline constexpr bool enable_borrowed_range<dd::ranges::slice_view<R, Policy>> =
+  enable_borrowed_range<R>;
+} // namespace std::ranges
+
 namespace dd::views
 {
+using dd::ranges::views::lazy_slice;
 using dd::ranges::views::slice;
-}
+using dd::ranges::views::slice_c;
+using dd::ranges::views::slice_with;
+} // namespace dd::views
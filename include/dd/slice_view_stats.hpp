@@ -0,0 +1,137 @@
+/**
+ * @file slice_view_stats.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+/*
+ * Opt-in instrumentation of the slice_view hot path.
+ *
+ * Defining DD_SLICE_VIEW_STATS before including any header of this library enables
+ * process-wide counters of:
+ *  - cache hits and misses of non_propagating_cache::get_or_emplace(),
+ *  - elements advanced while locating the ends of a slice,
+ *  - cached values dropped by copying, moving or assigning a non_propagating_cache.
+ *
+ * A high reset count relative to misses points at call sites that copy views after
+ * iterating them, which throws away their cached iterators.
+ *
+ * If DD_SLICE_VIEW_STATS is not defined, the recording macros expand to nothing, their
+ * arguments are not evaluated and no counters exist. The macro must be defined
+ * consistently in every translation unit of a program.
+ */
+
+#if defined(DD_SLICE_VIEW_STATS)
+
+#include <atomic>
+#include <cstdint>
+
+namespace dd
+{
+
+/**
+ * @brief Snapshot of the slice_view instrumentation counters.
+ */
+struct slice_view_stats
+{
+  /**
+   * @brief Number of get_or_emplace() calls that found a cached value.
+   */
+  std::uint64_t cache_hits{0};
+
+  /**
+   * @brief Number of get_or_emplace() calls that computed the value.
+   */
+  std::uint64_t cache_misses{0};
+
+  /**
+   * @brief Number of elements stepped over while locating slice positions.
+   */
+  std::uint64_t elements_advanced{0};
+
+  /**
+   * @brief Number of cached values dropped by a copy, move or assignment.
+   */
+  std::uint64_t cache_resets{0};
+};
+
+namespace detail
+{
+/**
+ * @brief Process-wide instrumentation counters.
+ */
+struct slice_view_counters
+{
+  static inline std::atomic<std::uint64_t> cache_hits{0};
+  static inline std::atomic<std::uint64_t> cache_misses{0};
+  static inline std::atomic<std::uint64_t> elements_advanced{0};
+  static inline std::atomic<std::uint64_t> cache_resets{0};
+
+  static auto add(std::atomic<std::uint64_t>& counter, std::uint64_t n) noexcept -> void
+  {
+    counter.fetch_add(n, std::memory_order_relaxed);
+  }
+};
+} // namespace detail
+
+/**
+ * @brief Gets the current values of the instrumentation counters.
+ * @return Snapshot of the counters.
+ */
+[[nodiscard]] inline auto get_slice_view_stats() noexcept -> slice_view_stats
+{
+  using counters = detail::slice_view_counters;
+  return {
+    .cache_hits = counters::cache_hits.load(std::memory_order_relaxed),
+    .cache_misses = counters::cache_misses.load(std::memory_order_relaxed),
+    .elements_advanced = counters::elements_advanced.load(std::memory_order_relaxed),
+    .cache_resets = counters::cache_resets.load(std::memory_order_relaxed),
+  };
+}
+
+/**
+ * @brief Resets all instrumentation counters to zero.
+ */
+inline auto reset_slice_view_stats() noexcept -> void
+{
+  using counters = detail::slice_view_counters;
+  counters::cache_hits.store(0, std::memory_order_relaxed);
+  counters::cache_misses.store(0, std::memory_order_relaxed);
+  counters::elements_advanced.store(0, std::memory_order_relaxed);
+  counters::cache_resets.store(0, std::memory_order_relaxed);
+}
+
+} // namespace dd
+
+// Counters are not touched during constant evaluation, so instrumented code stays
+// usable in constant expressions.
+#define DD_SLICE_VIEW_STATS_ADD(counter, n)                                             \
+  do                                                                                    \
+  {                                                                                     \
+    if !consteval                                                                       \
+    {                                                                                   \
+      ::dd::detail::slice_view_counters::add(                                           \
+        ::dd::detail::slice_view_counters::counter, static_cast<std::uint64_t>(n));     \
+    }                                                                                   \
+  } while (false)
+
+#define DD_SLICE_VIEW_STATS_HIT()         DD_SLICE_VIEW_STATS_ADD(cache_hits, 1)
+#define DD_SLICE_VIEW_STATS_MISS()        DD_SLICE_VIEW_STATS_ADD(cache_misses, 1)
+#define DD_SLICE_VIEW_STATS_ADVANCED(n)   DD_SLICE_VIEW_STATS_ADD(elements_advanced, n)
+#define DD_SLICE_VIEW_STATS_RESET(reset)                                                \
+  DD_SLICE_VIEW_STATS_ADD(cache_resets, (reset) ? 1 : 0)
+
+#else
+
+#define DD_SLICE_VIEW_STATS_HIT()         static_cast<void>(0)
+#define DD_SLICE_VIEW_STATS_MISS()        static_cast<void>(0)
+#define DD_SLICE_VIEW_STATS_ADVANCED(n)   static_cast<void>(0)
+#define DD_SLICE_VIEW_STATS_RESET(reset)  static_cast<void>(0)
+
+#endif
@@ -0,0 +1,515 @@
+/**
+ * @file slices_view.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/non_propagating_cache.hpp"
+#include "dd/slice_view.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief A random access range of consecutive chunks of a forward range.
+ *
+ * Chunk k is the slice_view [k * chunk_size, (k + 1) * chunk_size) of a reference to the
+ * base, and the last chunk may be shorter. Unlike std::views::chunk, any chunk can be
+ * accessed by its index:
+ *  - For sized random access bases, the chunks are computed by arithmetic.
+ *  - Otherwise, the iterators at the chunk boundaries are discovered lazily, by walking
+ *    the base one chunk at a time, and memoized. Chunk k is O(1) once discovered, and
+ *    its slice_view is seeded with both of its boundaries.
+ *
+ * The memoized boundaries are not propagated to copies. For forward bases, begin(),
+ * end() and chunk access are not const, since they may discover boundaries. Once all
+ * boundaries are discovered, e.g. by calling size(), chunks may be accessed
+ * concurrently. For sized random access bases, nothing is discovered, and the view is
+ * also const-iterable; its const chunks are slices of a reference to the const base.
+ * @tparam R The base view.
+ */
+template <std::ranges::forward_range R>
+  requires std::ranges::view<R>
+class slices_view : public std::ranges::view_interface<slices_view<R>>
+{
+  template <bool Const>
+  class iterator;
+
+public:
+  /**
+   * @brief Alias for the ranges difference type.
+   */
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  /**
+   * @brief Alias for the type of the chunks.
+   */
+  using slice_type = slice_view<std::ranges::ref_view<R>>;
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  constexpr slices_view()
+    requires std::default_initializable<R>
+  = default;
+
+  /**
+   * @brief Constructor.
+   * @param base The base view.
+   * @param chunk_size Number of elements per chunk.
+   */
+  constexpr slices_view(R base, difference_type chunk_size)
+      : base_{std::move(base)}, chunk_size_{chunk_size}
+  {
+    assert(chunk_size > 0);
+  }
+
+  /**
+   * @brief Gets a copy of the base view.
+   * @return A copy of the base view.
+   */
+  [[nodiscard]] constexpr auto base() const -> R
+    requires std::copy_constructible<R>
+  {
+    return base_;
+  }
+
+  /**
+   * @brief Gets the number of elements per chunk.
+   * @return The chunk size.
+   */
+  [[nodiscard]] constexpr auto chunk_size() const noexcept -> difference_type
+  {
+    return chunk_size_;
+  }
+
+  /**
+   * @brief Gets an iterator to the first chunk.
+   * @return Iterator to the first chunk.
+   */
+  [[nodiscard]] constexpr auto begin() -> iterator<false>
+  {
+    return iterator<false>{this, 0};
+  }
+
+  /**
+   * @brief Gets an iterator to the first chunk of a sized random access base.
+   * @return Iterator to the first chunk.
+   */
+  [[nodiscard]] constexpr auto begin() const -> iterator<true>
+    requires std::ranges::random_access_range<R const> &&
+             std::ranges::sized_range<R const>
+  {
+    return iterator<true>{this, 0};
+  }
+
+  /**
+   * @brief Gets the end of the chunks.
+   * @return An iterator past the last chunk for sized bases, otherwise a sentinel that
+   * discovers the boundaries up to the compared iterator.
+   */
+  [[nodiscard]] constexpr auto end()
+  {
+    if constexpr (std::ranges::sized_range<R>)
+    {
+      return iterator<false>{this, count()};
+    }
+    else
+    {
+      return std::default_sentinel;
+    }
+  }
+
+  /**
+   * @brief Gets an iterator past the last chunk of a sized random access base.
+   * @return Iterator past the last chunk.
+   */
+  [[nodiscard]] constexpr auto end() const -> iterator<true>
+    requires std::ranges::random_access_range<R const> &&
+             std::ranges::sized_range<R const>
+  {
+    return iterator<true>{this, count()};
+  }
+
+  /**
+   * @brief Gets the number of chunks.
+   * @details For bases that are not sized, all boundaries are discovered by the first
+   * call.
+   * @return The number of chunks.
+   */
+  [[nodiscard]] constexpr auto size() -> std::size_t
+  {
+    return static_cast<std::size_t>(count());
+  }
+
+  /**
+   * @brief Gets the number of chunks of a sized base.
+   * @return The number of chunks.
+   */
+  [[nodiscard]] constexpr auto size() const -> std::size_t
+    requires std::ranges::sized_range<R const>
+  {
+    return static_cast<std::size_t>(count());
+  }
+
+  /**
+   * @brief Gets a chunk by its index.
+   * @details Discovers the boundaries up to the chunk, if they were not yet.
+   * @param k Index of the chunk.
+   * @return The slice_view of the chunk. Chunks past the end are empty.
+   */
+  [[nodiscard]] constexpr auto chunk(difference_type k) -> slice_type
+  {
+    const auto start = k * chunk_size_;
+    const auto end = start + chunk_size_;
+    if constexpr (std::ranges::random_access_range<R> && std::ranges::sized_range<R>)
+    {
+      return slice_type(std::ranges::ref_view<R>(base_), start, end);
+    }
+    else
+    {
+      auto first = boundary(k);
+      auto last = boundary(k + 1);
+      return slice_type(
+        std::ranges::ref_view<R>(base_), start, end, std::move(first), std::move(last));
+    }
+  }
+
+  /**
+   * @brief Gets a chunk of a sized random access base by its index.
+   * @param k Index of the chunk.
+   * @return The slice_view of the chunk of the const base. Chunks past the end are
+   * empty.
+   */
+  [[nodiscard]] constexpr auto chunk(difference_type k) const
+    -> slice_view<std::ranges::ref_view<R const>>
+    requires std::ranges::random_access_range<R const> &&
+             std::ranges::sized_range<R const>
+  {
+    const auto start = k * chunk_size_;
+    return slice_view<std::ranges::ref_view<R const>>(
+      std::ranges::ref_view<R const>(base_), start, start + chunk_size_);
+  }
+
+private:
+  /**
+   * @brief Gets the number of chunks, discovering all boundaries if needed.
+   * @return The number of chunks.
+   */
+  [[nodiscard]] constexpr auto count() -> difference_type
+  {
+    if constexpr (std::ranges::sized_range<R>)
+    {
+      const auto size = static_cast<difference_type>(std::ranges::ssize(base_));
+      return (size + chunk_size_ - 1) / chunk_size_;
+    }
+    else
+    {
+      discover(std::numeric_limits<difference_type>::max());
+      return *count_;
+    }
+  }
+
+  /**
+   * @brief Gets the number of chunks of a sized base.
+   * @return The number of chunks.
+   */
+  [[nodiscard]] constexpr auto count() const -> difference_type
+    requires std::ranges::sized_range<R const>
+  {
+    const auto size = static_cast<difference_type>(std::ranges::ssize(base_));
+    return (size + chunk_size_ - 1) / chunk_size_;
+  }
+
+  /**
+   * @brief Checks if a chunk index is past the last chunk.
+   * @param k Index of the chunk.
+   * @return True if there is no chunk k.
+   */
+  [[nodiscard]] constexpr auto is_end(difference_type k) -> bool
+  {
+    if constexpr (std::ranges::sized_range<R>)
+    {
+      return k >= count();
+    }
+    else
+    {
+      // Chunk k exists iff the boundary after it is discovered.
+      discover(k + 1);
+      return count_.has_value() && k >= *count_;
+    }
+  }
+
+  /**
+   * @brief Checks if a chunk index is past the last chunk of a sized base.
+   * @param k Index of the chunk.
+   * @return True if there is no chunk k.
+   */
+  [[nodiscard]] constexpr auto is_end(difference_type k) const -> bool
+    requires std::ranges::sized_range<R const>
+  {
+    return k >= count();
+  }
+
+  /**
+   * @brief Gets the iterator at the beginning of a chunk.
+   * @param k Index of the chunk.
+   * @return The base iterator at the boundary, clamped to the end of the base.
+   */
+  [[nodiscard]] constexpr auto boundary(difference_type k) -> std::ranges::iterator_t<R>
+  {
+    discover(k);
+    auto& boundaries = *boundaries_;
+    const auto last = static_cast<difference_type>(boundaries.size()) - 1;
+    return boundaries[static_cast<std::size_t>(std::min(k, last))];
+  }
+
+  /**
+   * @brief Discovers the chunk boundaries up to a chunk, or up to the end of the base.
+   * @param k Index of the chunk.
+   */
+  constexpr auto discover(difference_type k) -> void
+  {
+    auto& boundaries = boundaries_.get_or_emplace(
+      [this] { return std::vector{std::ranges::begin(base_)}; });
+    while (!count_.has_value() && static_cast<difference_type>(boundaries.size()) <= k)
+    {
+      auto iter = boundaries.back();
+      const auto advanced =
+        detail::counted_advance(iter, chunk_size_, std::ranges::end(base_));
+      if (advanced > 0)
+      {
+        boundaries.push_back(std::move(iter));
+      }
+      if (advanced < chunk_size_)
+      {
+        count_.emplace(static_cast<difference_type>(boundaries.size()) - 1);
+      }
+    }
+  }
+
+  R base_{};
+  difference_type chunk_size_{1};
+  non_propagating_cache<std::vector<std::ranges::iterator_t<R>>> boundaries_;
+  non_propagating_cache<difference_type> count_;
+};
+
+/**
+ * @brief Random access iterator over the chunks of a slices_view.
+ * @tparam Const Whether the iterator is over a const slices_view.
+ */
+template <std::ranges::forward_range R>
+  requires std::ranges::view<R>
+template <bool Const>
+class slices_view<R>::iterator
+{
+  using parent_type = std::conditional_t<Const, slices_view const, slices_view>;
+  using base_type = std::conditional_t<Const, R const, R>;
+
+public:
+  using iterator_concept = std::random_access_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+  using value_type = slice_view<std::ranges::ref_view<base_type>>;
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  iterator() = default;
+
+  constexpr iterator(parent_type* parent, difference_type index)
+      : parent_{parent}, index_{index}
+  {
+  }
+
+  [[nodiscard]] constexpr auto operator*() const -> value_type
+  {
+    return parent_->chunk(index_);
+  }
+
+  [[nodiscard]] constexpr auto operator[](difference_type n) const -> value_type
+  {
+    return parent_->chunk(index_ + n);
+  }
+
+  constexpr auto operator++() -> iterator&
+  {
+    ++index_;
+    return *this;
+  }
+
+  constexpr auto operator++(int) -> iterator
+  {
+    auto tmp = *this;
+    ++index_;
+    return tmp;
+  }
+
+  constexpr auto operator--() -> iterator&
+  {
+    --index_;
+    return *this;
+  }
+
+  constexpr auto operator--(int) -> iterator
+  {
+    auto tmp = *this;
+    --index_;
+    return tmp;
+  }
+
+  constexpr auto operator+=(difference_type n) -> iterator&
+  {
+    index_ += n;
+    return *this;
+  }
+
+  constexpr auto operator-=(difference_type n) -> iterator&
+  {
+    index_ -= n;
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr auto operator+(iterator iter, difference_type n)
+    -> iterator
+  {
+    return iter += n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator+(difference_type n, iterator iter)
+    -> iterator
+  {
+    return iter += n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator-(iterator iter, difference_type n)
+    -> iterator
+  {
+    return iter -= n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator-(iterator const& x, iterator const& y)
+    -> difference_type
+  {
+    return x.index_ - y.index_;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(iterator const& x, iterator const& y)
+    -> bool
+  {
+    return x.index_ == y.index_;
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator<=>(iterator const& x, iterator const& y) -> std::strong_ordering
+  {
+    return x.index_ <=> y.index_;
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(iterator const& iter, std::default_sentinel_t) -> bool
+  {
+    return iter.at_end();
+  }
+
+private:
+  [[nodiscard]] constexpr auto at_end() const -> bool { return parent_->is_end(index_); }
+
+  parent_type* parent_{nullptr};
+  difference_type index_{0};
+};
+
+/**
+ * @brief Deduction guide for slices_view.
+ * @details Wraps the input range type in std::views::all_t.
+ */
+template <typename R>
+slices_view(R&&, std::ranges::range_difference_t<R>) -> slices_view<std::views::all_t<R>>;
+
+} // namespace dd::ranges
+
+namespace dd::ranges::views
+{
+
+namespace detail
+{
+/**
+ * @brief Range adaptor closure for @c slices_view.
+ * @tparam DifferenceType The type of the chunk size.
+ */
+template <std::integral DifferenceType>
+class slices_range_adaptor
+    : public std::ranges::range_adaptor_closure<slices_range_adaptor<DifferenceType>>
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param chunk_size Number of elements per chunk.
+   */
+  constexpr explicit slices_range_adaptor(DifferenceType chunk_size)
+      : chunk_size_{chunk_size}
+  {
+  }
+
+  /**
+   * @brief Required operator for range_adaptor_closure.
+   * @param range The range to chunk.
+   * @return A slices_view of the range.
+   */
+  template <std::ranges::viewable_range R>
+    requires std::ranges::forward_range<R>
+  [[nodiscard]] constexpr auto operator()(R&& r) const
+  {
+    using view_type = std::views::all_t<R>;
+    return slices_view<view_type>(
+      std::views::all(std::forward<R>(r)),
+      static_cast<std::ranges::range_difference_t<view_type>>(chunk_size_));
+  }
+
+private:
+  DifferenceType chunk_size_;
+};
+
+/**
+ * @brief Range adaptor object type for @c slices_view.
+ */
+struct slices_fn
+{
+  /**
+   * @brief Creates a range adaptor closure.
+   * @param chunk_size Number of elements per chunk.
+   * @return The range adaptor closure.
+   */
+  template <std::integral D>
+  [[nodiscard]] constexpr auto operator()(D chunk_size) const
+  {
+    return slices_range_adaptor<D>{chunk_size};
+  }
+};
+} // namespace detail
+
+/**
+ * @brief Range adaptor object for slices_view.
+ */
+inline constexpr auto slices = detail::slices_fn{};
+
+} // namespace dd::ranges::views
+
+namespace dd::views
+{
+using dd::ranges::views::slices;
+} // namespace dd::views
@@ -0,0 +1,278 @@
+/**
+ * @file stride_iterator.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief An iterator that visits every n-th element of a bounded iterator range.
+ *
+ * The iterator is bounded by an iterator to the end of the range, and is never advanced
+ * past it. For random access iterators, all arithmetic is constant time. Otherwise the
+ * stride iterator is a forward iterator that steps the underlying iterator one element at
+ * a time.
+ *
+ * Like the iterator of std::ranges::stride_view, the number of elements that were
+ * "missing" from the last step before reaching the bound is kept, so that iterators can
+ * be decremented from the end and their distances are exact.
+ *
+ * @tparam I The underlying iterator type.
+ */
+template <std::forward_iterator I>
+class stride_iterator
+{
+public:
+  /**
+   * @brief Iterator concept tag.
+   */
+  using iterator_concept = std::conditional_t<
+    std::random_access_iterator<I>,
+    std::random_access_iterator_tag,
+    std::forward_iterator_tag>;
+
+  /**
+   * @brief Value type of the underlying iterator.
+   */
+  using value_type = std::iter_value_t<I>;
+
+  /**
+   * @brief Difference type of the underlying iterator.
+   */
+  using difference_type = std::iter_difference_t<I>;
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  stride_iterator() = default;
+
+  /**
+   * @brief Constructor.
+   * @param current The current position.
+   * @param end The end of the bounded range.
+   * @param step Number of elements advanced by each increment.
+   * @param missing Number of elements missing from the last step, if current is end.
+   */
+  constexpr stride_iterator(
+    I current, I end, difference_type step, difference_type missing = 0)
+      : current_{std::move(current)},
+        end_{std::move(end)},
+        step_{step},
+        missing_{missing}
+  {
+  }
+
+  /**
+   * @brief Gets the underlying iterator.
+   * @return Reference to the underlying iterator.
+   */
+  [[nodiscard]] constexpr auto base() const& noexcept -> I const& { return current_; }
+
+  /**
+   * @brief Gets the underlying iterator.
+   * @return The moved underlying iterator.
+   */
+  [[nodiscard]] constexpr auto base() && -> I { return std::move(current_); }
+
+  /**
+   * @brief Gets the number of elements advanced by each increment.
+   * @return Step of the iterator.
+   */
+  [[nodiscard]] constexpr auto step() const noexcept -> difference_type { return step_; }
+
+  /**
+   * @brief Dereference operator.
+   * @return Reference of the underlying iterator.
+   */
+  [[nodiscard]] constexpr auto operator*() const -> decltype(auto) { return *current_; }
+
+  /**
+   * @brief Subscript operator.
+   * @param n Number of steps.
+   * @return Reference of the underlying iterator advanced by n steps.
+   */
+  [[nodiscard]] constexpr auto operator[](difference_type n) const -> decltype(auto)
+    requires std::random_access_iterator<I>
+  {
+    return *(*this + n);
+  }
+
+  /**
+   * @brief Pre-increment operator.
+   * @return Reference to this.
+   */
+  constexpr auto operator++() -> stride_iterator&
+  {
+    missing_ = std::ranges::advance(current_, step_, end_);
+    return *this;
+  }
+
+  /**
+   * @brief Post-increment operator.
+   * @return Copy of the iterator before incrementing.
+   */
+  constexpr auto operator++(int) -> stride_iterator
+  {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  /**
+   * @brief Pre-decrement operator.
+   * @return Reference to this.
+   */
+  constexpr auto operator--() -> stride_iterator&
+    requires std::random_access_iterator<I>
+  {
+    std::ranges::advance(current_, missing_ - step_);
+    missing_ = 0;
+    return *this;
+  }
+
+  /**
+   * @brief Post-decrement operator.
+   * @return Copy of the iterator before decrementing.
+   */
+  constexpr auto operator--(int) -> stride_iterator
+    requires std::random_access_iterator<I>
+  {
+    auto tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  /**
+   * @brief Advances the iterator by n steps in constant time.
+   * @param n Number of steps.
+   * @return Reference to this.
+   */
+  constexpr auto operator+=(difference_type n) -> stride_iterator&
+    requires std::random_access_iterator<I>
+  {
+    if (n > 0)
+    {
+      missing_ = std::ranges::advance(current_, step_ * n, end_);
+    }
+    else if (n < 0)
+    {
+      std::ranges::advance(current_, step_ * n + missing_);
+      missing_ = 0;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Moves the iterator back by n steps in constant time.
+   * @param n Number of steps.
+   * @return Reference to this.
+   */
+  constexpr auto operator-=(difference_type n) -> stride_iterator&
+    requires std::random_access_iterator<I>
+  {
+    return *this += -n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator+(stride_iterator iter, difference_type n)
+    -> stride_iterator
+    requires std::random_access_iterator<I>
+  {
+    return iter += n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator+(difference_type n, stride_iterator iter)
+    -> stride_iterator
+    requires std::random_access_iterator<I>
+  {
+    return iter += n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator-(stride_iterator iter, difference_type n)
+    -> stride_iterator
+    requires std::random_access_iterator<I>
+  {
+    return iter -= n;
+  }
+
+  /**
+   * @brief Number of steps between two iterators, in constant time.
+   * @param x Left iterator.
+   * @param y Right iterator.
+   * @return Distance from y to x in steps.
+   */
+  [[nodiscard]] friend constexpr auto
+  operator-(stride_iterator const& x, stride_iterator const& y) -> difference_type
+    requires std::random_access_iterator<I>
+  {
+    return (x.current_ - y.current_ + x.missing_ - y.missing_) / x.step_;
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(stride_iterator const& x, stride_iterator const& y) -> bool
+  {
+    return x.current_ == y.current_;
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator<(stride_iterator const& x, stride_iterator const& y) -> bool
+    requires std::random_access_iterator<I>
+  {
+    return x.current_ < y.current_;
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator>(stride_iterator const& x, stride_iterator const& y) -> bool
+    requires std::random_access_iterator<I>
+  {
+    return y < x;
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator<=(stride_iterator const& x, stride_iterator const& y) -> bool
+    requires std::random_access_iterator<I>
+  {
+    return !(y < x);
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator>=(stride_iterator const& x, stride_iterator const& y) -> bool
+    requires std::random_access_iterator<I>
+  {
+    return !(x < y);
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator<=>(stride_iterator const& x, stride_iterator const& y)
+    requires std::random_access_iterator<I> && std::three_way_comparable<I>
+  {
+    return x.current_ <=> y.current_;
+  }
+
+  [[nodiscard]] friend constexpr auto iter_move(stride_iterator const& iter) noexcept(
+    noexcept(std::ranges::iter_move(iter.current_))) -> decltype(auto)
+  {
+    return std::ranges::iter_move(iter.current_);
+  }
+
+private:
+  I current_{};
+  I end_{};
+  difference_type step_{1};
+  difference_type missing_{0};
+};
+
+} // namespace dd::ranges
@@ -0,0 +1,168 @@
+/**
+ * @file to.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/reserve_hint.hpp"
+
+#include <concepts>
+#include <ranges>
+#include <utility>
+
+namespace dd::ranges
+{
+
+namespace detail
+{
+/**
+ * @brief Concept for containers that can reserve capacity and append elements.
+ */
+template <typename C, typename R>
+concept reservable_appendable = requires(C& c, std::ranges::range_size_t<C> n) {
+  c.reserve(n);
+  c.emplace_back(std::declval<std::ranges::range_reference_t<R>>());
+};
+
+/**
+ * @brief Concept for ranges that dd::ranges::to materializes by reserving the hint.
+ * @details Sized ranges are left to std::ranges::to, which already reserves their size,
+ * unless they provide a member reserve_hint(), since their size may traverse them (e.g.
+ * slices of forward ranges).
+ */
+template <typename C, typename R>
+concept reserves_hint =
+  approximately_sized_range<R> &&
+  (!std::ranges::sized_range<R> || reserve_hint_impl::has_member_reserve_hint<R>) &&
+  std::default_initializable<C> && reservable_appendable<C, R>;
+
+/**
+ * @brief Range adaptor closure for dd::ranges::to.
+ * @tparam C The container type.
+ */
+template <typename C>
+struct to_range_adaptor : std::ranges::range_adaptor_closure<to_range_adaptor<C>>
+{
+  /**
+   * @brief Required operator for range_adaptor_closure.
+   * @param r The range to materialize.
+   * @return The container.
+   */
+  template <std::ranges::input_range R>
+  [[nodiscard]] constexpr auto operator()(R&& r) const;
+};
+
+/**
+ * @brief Range adaptor closure for dd::ranges::to with a deduced element type.
+ * @tparam C The container template.
+ */
+template <template <typename...> typename C>
+struct to_template_range_adaptor
+    : std::ranges::range_adaptor_closure<to_template_range_adaptor<C>>
+{
+  /**
+   * @brief Required operator for range_adaptor_closure.
+   * @param r The range to materialize.
+   * @return The container.
+   */
+  template <std::ranges::input_range R>
+  [[nodiscard]] constexpr auto operator()(R&& r) const;
+};
+} // namespace detail
+
+/**
+ * @brief Materializes a range into a container.
+ * @details Like std::ranges::to, but for ranges that are not sized and provide a
+ * reserve_hint (e.g. a lazy-sentinel slice_view of a filter_view, or a slice of an
+ * input range), the container reserves the hint once before the elements are appended,
+ * rather than growing geometrically. So do ranges with a member reserve_hint(), such as
+ * slices of forward ranges, whose size would traverse them before they are copied.
+ * Other ranges are materialized by std::ranges::to.
+ * @tparam C The container type.
+ * @param r The range to materialize.
+ * @param args Arguments for the constructor of the container.
+ * @return The container.
+ */
+template <typename C, std::ranges::input_range R, typename... Args>
+  requires(!std::ranges::view<C>)
+[[nodiscard]] constexpr auto to(R&& r, Args&&... args) -> C
+{
+  if constexpr (detail::reserves_hint<C, R> && sizeof...(Args) == 0)
+  {
+    auto c = C{};
+    c.reserve(static_cast<std::ranges::range_size_t<C>>(dd::ranges::reserve_hint(r)));
+    for (auto&& element : r)
+    {
+      c.emplace_back(std::forward<decltype(element)>(element));
+    }
+    return c;
+  }
+  else
+  {
+    return std::ranges::to<C>(std::forward<R>(r), std::forward<Args>(args)...);
+  }
+}
+
+/**
+ * @brief Materializes a range into a container, deducing its element type.
+ * @details The container is C<std::ranges::range_value_t<R>>, see to().
+ * @tparam C The container template, e.g. std::vector.
+ * @param r The range to materialize.
+ * @param args Arguments for the constructor of the container.
+ * @return The container.
+ */
+template <template <typename...> typename C, std::ranges::input_range R, typename... Args>
+[[nodiscard]] constexpr auto to(R&& r, Args&&... args)
+{
+  return dd::ranges::to<C<std::ranges::range_value_t<R>>>(
+    std::forward<R>(r), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Creates a range adaptor closure that materializes a range into a container.
+ * @tparam C The container type.
+ * @return The range adaptor closure.
+ */
+template <typename C>
+  requires(!std::ranges::view<C>)
+[[nodiscard]] constexpr auto to() -> detail::to_range_adaptor<C>
+{
+  return {};
+}
+
+/**
+ * @brief Creates a range adaptor closure that materializes a range into a container,
+ * deducing its element type.
+ * @tparam C The container template, e.g. std::vector.
+ * @return The range adaptor closure.
+ */
+template <template <typename...> typename C>
+[[nodiscard]] constexpr auto to() -> detail::to_template_range_adaptor<C>
+{
+  return {};
+}
+
+namespace detail
+{
+template <typename C>
+template <std::ranges::input_range R>
+constexpr auto to_range_adaptor<C>::operator()(R&& r) const
+{
+  return dd::ranges::to<C>(std::forward<R>(r));
+}
+
+template <template <typename...> typename C>
+template <std::ranges::input_range R>
+constexpr auto to_template_range_adaptor<C>::operator()(R&& r) const
+{
+  return dd::ranges::to<C>(std::forward<R>(r));
+}
+} // namespace detail
+
+} // namespace dd::ranges
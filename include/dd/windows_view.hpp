@@ -0,0 +1,292 @@
+/**
+ * @file windows_view.hpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#pragma once
+
+#include "dd/slice_view.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace dd::ranges
+{
+
+/**
+ * @brief A forward range of sliding windows over a forward range.
+ *
+ * Window k is the slice_view [k * step, k * step + width) of a reference to the base.
+ * Like std::views::slide, only full windows are produced. The iterator holds the current
+ * window and moves it with slice_view::advance_window(), so both of its cached iterators
+ * advance by step elements per window: a full scan of a forward range costs O(n)
+ * increments, rather than O(n) per window. Dereferencing yields a slice_view seeded with
+ * the iterators of the current window.
+ *
+ * Copying an iterator copies its window, whose caches do not propagate, so the copy
+ * locates its window again when it is used. As for std::ranges::filter_view, begin() is
+ * not const.
+ * @tparam R The base view.
+ */
+template <std::ranges::forward_range R>
+  requires std::ranges::view<R>
+class windows_view : public std::ranges::view_interface<windows_view<R>>
+{
+  class iterator;
+
+public:
+  /**
+   * @brief Alias for the ranges difference type.
+   */
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  /**
+   * @brief Alias for the type of the windows.
+   */
+  using slice_type = slice_view<std::ranges::ref_view<R>>;
+
+  /**
+   * @brief Defaulted constructor.
+   */
+  constexpr windows_view()
+    requires std::default_initializable<R>
+  = default;
+
+  /**
+   * @brief Constructor.
+   * @param base The base view.
+   * @param width Number of elements per window.
+   * @param step Number of elements between the beginnings of consecutive windows.
+   */
+  constexpr windows_view(R base, difference_type width, difference_type step)
+      : base_{std::move(base)}, width_{width}, step_{step}
+  {
+    assert(width > 0 && step > 0);
+  }
+
+  /**
+   * @brief Gets a copy of the base view.
+   * @return A copy of the base view.
+   */
+  [[nodiscard]] constexpr auto base() const -> R
+    requires std::copy_constructible<R>
+  {
+    return base_;
+  }
+
+  /**
+   * @brief Gets an iterator to the first window.
+   * @details Locates the first window.
+   * @return Iterator to the first window.
+   */
+  [[nodiscard]] constexpr auto begin() -> iterator
+  {
+    auto window = slice_type(std::ranges::ref_view<R>(base_), 0, width_);
+    return iterator{std::move(window), width_, step_};
+  }
+
+  /**
+   * @brief Gets the end of the windows.
+   * @return A sentinel that compares equal to an iterator past the last full window.
+   */
+  [[nodiscard]] constexpr auto end() const noexcept -> std::default_sentinel_t
+  {
+    return std::default_sentinel;
+  }
+
+  /**
+   * @brief Gets the number of windows of a sized base.
+   * @return The number of full windows.
+   */
+  [[nodiscard]] constexpr auto size() -> std::size_t
+    requires std::ranges::sized_range<R>
+  {
+    const auto size = static_cast<difference_type>(std::ranges::ssize(base_));
+    return static_cast<std::size_t>(size < width_ ? 0 : (size - width_) / step_ + 1);
+  }
+
+private:
+  R base_{};
+  difference_type width_{1};
+  difference_type step_{1};
+};
+
+/**
+ * @brief Forward iterator over the windows of a windows_view.
+ */
+template <std::ranges::forward_range R>
+  requires std::ranges::view<R>
+class windows_view<R>::iterator
+{
+public:
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+  using value_type = slice_type;
+  using difference_type = std::ranges::range_difference_t<R>;
+
+  iterator() = default;
+
+  constexpr iterator(slice_type window, difference_type width, difference_type step)
+      : window_{std::move(window)}, width_{width}, step_{step}
+  {
+    check_full();
+  }
+
+  /**
+   * @brief Gets the current window.
+   * @return A slice_view seeded with the iterators of the current window.
+   */
+  [[nodiscard]] constexpr auto operator*() const -> slice_type
+  {
+    return slice_type(
+      window_->base(), window_->start_index(), window_->end_index(), window_->begin(),
+      window_->end());
+  }
+
+  /**
+   * @brief Moves to the next window, advancing the window's iterators by the step.
+   * @return Reference to this.
+   */
+  constexpr auto operator++() -> iterator&
+  {
+    window_->advance_window(step_);
+    check_full();
+    return *this;
+  }
+
+  constexpr auto operator++(int) -> iterator
+  {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(iterator const& x, iterator const& y)
+    -> bool
+  {
+    return x.done_ == y.done_ &&
+           (x.done_ || x.window_->start_index() == y.window_->start_index());
+  }
+
+  [[nodiscard]] friend constexpr auto
+  operator==(iterator const& iter, std::default_sentinel_t) -> bool
+  {
+    return iter.done_;
+  }
+
+private:
+  /**
+   * @brief Checks if the current window is full, i.e. not truncated by the end of the
+   * base.
+   * @details The length of the window is known from its indices for sized bases, and is
+   * cached by the window when its iterators advance by whole steps otherwise.
+   */
+  constexpr auto check_full() -> void
+  {
+    done_ = static_cast<difference_type>(window_->size()) < width_;
+  }
+
+  std::optional<slice_type> window_{};
+  difference_type width_{1};
+  difference_type step_{1};
+  bool done_{true};
+};
+
+/**
+ * @brief Deduction guide for windows_view.
+ * @details Wraps the input range type in std::views::all_t.
+ */
+template <typename R>
+windows_view(R&&, std::ranges::range_difference_t<R>, std::ranges::range_difference_t<R>)
+  -> windows_view<std::views::all_t<R>>;
+
+} // namespace dd::ranges
+
+namespace dd::ranges::views
+{
+
+namespace detail
+{
+/**
+ * @brief Range adaptor closure for @c windows_view.
+ * @tparam DifferenceType The type of the width and step.
+ */
+template <std::integral DifferenceType>
+class windows_range_adaptor
+    : public std::ranges::range_adaptor_closure<windows_range_adaptor<DifferenceType>>
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param width Number of elements per window.
+   * @param step Number of elements between the beginnings of consecutive windows.
+   */
+  constexpr windows_range_adaptor(DifferenceType width, DifferenceType step)
+      : width_{width}, step_{step}
+  {
+  }
+
+  /**
+   * @brief Required operator for range_adaptor_closure.
+   * @param range The range to take windows of.
+   * @return A windows_view of the range.
+   */
+  template <std::ranges::viewable_range R>
+    requires std::ranges::forward_range<R>
+  [[nodiscard]] constexpr auto operator()(R&& r) const
+  {
+    using view_type = std::views::all_t<R>;
+    using difference_type = std::ranges::range_difference_t<view_type>;
+    return windows_view<view_type>(
+      std::views::all(std::forward<R>(r)), static_cast<difference_type>(width_),
+      static_cast<difference_type>(step_));
+  }
+
+private:
+  DifferenceType width_;
+  DifferenceType step_;
+};
+
+/**
+ * @brief Range adaptor object type for @c windows_view.
+ */
+struct windows_fn
+{
+  /**
+   * @brief Creates a range adaptor closure.
+   * @param width Number of elements per window.
+   * @param step Number of elements between the beginnings of consecutive windows.
+   * @return The range adaptor closure.
+   */
+  template <std::integral Width, std::integral Step = Width>
+  [[nodiscard]] constexpr auto operator()(Width width, Step step = 1) const
+  {
+    using difference_type = std::common_type_t<Width, Step>;
+    return windows_range_adaptor<difference_type>{
+      static_cast<difference_type>(width), static_cast<difference_type>(step)};
+  }
+};
+} // namespace detail
+
+/**
+ * @brief Range adaptor object for windows_view.
+ */
+inline constexpr auto windows = detail::windows_fn{};
+
+} // namespace dd::ranges::views
+
+namespace dd::views
+{
+using dd::ranges::views::windows;
+} // namespace dd::views
@@ -0,0 +1,74 @@
+/**
+ * @file test_slice_view_stats.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+// This file is built as its own executable with DD_SLICE_VIEW_STATS defined, since the
+// macro must be defined consistently across a program.
+#include "dd/slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <ranges>
+#include <vector>
+
+#if !defined(DD_SLICE_VIEW_STATS)
+#error "test_slice_view_stats.cpp must be compiled with DD_SLICE_VIEW_STATS defined"
+#endif
+
+TEST_CASE(
+  "slice_view_stats: counts cache hits, misses and advances", "[slice_view][stats]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7};
+  auto filtered = v | std::views::filter([](int x) { return x >= 0; });
+  auto sv = dd::ranges::slice_view(filtered, 2, 5);
+
+  dd::reset_slice_view_stats();
+
+  // The first begin() locates the starting position, the second one is cached.
+  [[maybe_unused]] auto first = sv.begin();
+  first = sv.begin();
+  auto stats = dd::get_slice_view_stats();
+  REQUIRE(stats.cache_misses == 1);
+  REQUIRE(stats.cache_hits == 1);
+  REQUIRE(stats.elements_advanced == 2);
+
+  // end() is advanced from the cached begin. The base is not sized, so the length found
+  // on the way fills the size cache, which is a third miss.
+  [[maybe_unused]] auto last = sv.end();
+  stats = dd::get_slice_view_stats();
+  REQUIRE(stats.cache_misses == 3);
+  REQUIRE(stats.cache_hits == 2);
+  REQUIRE(stats.elements_advanced == 5);
+  REQUIRE(stats.cache_resets == 0);
+}
+
+TEST_CASE("slice_view_stats: counts caches dropped by copies", "[slice_view][stats]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7};
+  auto filtered = v | std::views::filter([](int x) { return x >= 0; });
+  auto sv = dd::ranges::slice_view(filtered, 1, 6);
+
+  // Copying a view before it is iterated loses nothing.
+  dd::reset_slice_view_stats();
+  [[maybe_unused]] auto fresh_copy = sv;
+  REQUIRE(dd::get_slice_view_stats().cache_resets == 0);
+
+  // Copying it after begin() and end() are cached drops both cached iterators, and the
+  // length cached by end().
+  [[maybe_unused]] auto first = sv.begin();
+  [[maybe_unused]] auto last = sv.end();
+  dd::reset_slice_view_stats();
+  auto copy = sv;
+  REQUIRE(dd::get_slice_view_stats().cache_resets == 3);
+
+  // The copy locates its positions again.
+  [[maybe_unused]] auto copy_first = copy.begin();
+  REQUIRE(dd::get_slice_view_stats().cache_misses == 1);
+  REQUIRE(dd::get_slice_view_stats().elements_advanced == 1);
+}
@@ -0,0 +1,144 @@
+/**
+ * @file test_advance_by.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/advance_by.hpp"
+#include "dd/slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <ranges>
+
+namespace test
+{
+/**
+ * @brief A forward iterator over consecutive integers that counts its skips.
+ * @tparam Member If true, skipping is a member function, otherwise it is found by ADL.
+ */
+template <bool Member>
+struct skipping_iterator
+{
+  using value_type = int;
+  using difference_type = std::ptrdiff_t;
+
+  int value{0};
+  int* skips{nullptr};
+  int* increments{nullptr};
+
+  auto operator*() const -> int { return value; }
+
+  auto operator++() -> skipping_iterator&
+  {
+    ++value;
+    ++*increments;
+    return *this;
+  }
+
+  auto operator++(int) -> skipping_iterator
+  {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  friend auto operator==(skipping_iterator const& x, skipping_iterator const& y) -> bool
+  {
+    return x.value == y.value;
+  }
+
+  auto skip(difference_type n, skipping_iterator const& bound) -> difference_type
+  {
+    ++*skips;
+    const auto step = std::min<difference_type>(n, bound.value - value);
+    value += static_cast<int>(step);
+    return n - step;
+  }
+
+  auto advance_by(difference_type n, skipping_iterator bound) -> difference_type
+    requires Member
+  {
+    return skip(n, bound);
+  }
+
+  friend auto
+  advance_by(skipping_iterator& iter, difference_type n, skipping_iterator bound)
+    -> difference_type
+    requires(!Member)
+  {
+    return iter.skip(n, bound);
+  }
+};
+
+static_assert(std::forward_iterator<skipping_iterator<true>>);
+static_assert(std::forward_iterator<skipping_iterator<false>>);
+} // namespace test
+
+TEST_CASE("advance_by: dispatches to a member advance_by", "[advance_by]")
+{
+  auto skips = 0;
+  auto increments = 0;
+  auto iter = test::skipping_iterator<true>{0, &skips, &increments};
+  const auto bound = test::skipping_iterator<true>{100, &skips, &increments};
+
+  REQUIRE(dd::ranges::advance_by(iter, 40, bound) == 0);
+  REQUIRE(*iter == 40);
+  REQUIRE(dd::ranges::advance_by(iter, 80, bound) == 20);
+  REQUIRE(*iter == 100);
+  REQUIRE(skips == 2);
+  REQUIRE(increments == 0);
+}
+
+TEST_CASE("advance_by: dispatches to advance_by found by ADL", "[advance_by]")
+{
+  auto skips = 0;
+  auto increments = 0;
+  auto iter = test::skipping_iterator<false>{0, &skips, &increments};
+  const auto bound = test::skipping_iterator<false>{100, &skips, &increments};
+
+  REQUIRE(dd::ranges::advance_by(iter, 40, bound) == 0);
+  REQUIRE(*iter == 40);
+  REQUIRE(skips == 1);
+  REQUIRE(increments == 0);
+}
+
+TEST_CASE("advance_by: falls back to std::ranges::advance", "[advance_by]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4};
+  auto iter = lst.begin();
+  REQUIRE(dd::ranges::advance_by(iter, 3, lst.end()) == 0);
+  REQUIRE(*iter == 3);
+  REQUIRE(dd::ranges::advance_by(iter, 5, lst.end()) == 3);
+  REQUIRE(iter == lst.end());
+  REQUIRE(dd::ranges::advance_by(iter, -2, lst.begin()) == 0);
+  REQUIRE(*iter == 3);
+}
+
+TEST_CASE(
+  "advance_by: slice_view locates its ends by skipping", "[advance_by][slice_view]")
+{
+  auto skips = 0;
+  auto increments = 0;
+  auto numbers = std::ranges::subrange(
+    test::skipping_iterator<true>{0, &skips, &increments},
+    test::skipping_iterator<true>{1000, &skips, &increments});
+
+  auto sv = numbers | dd::views::slice(500, 503);
+  REQUIRE(*sv.begin() == 500);
+  REQUIRE(skips == 1);
+
+  [[maybe_unused]] auto last = sv.end();
+  REQUIRE(skips == 2);
+  REQUIRE(increments == 0);
+
+  REQUIRE(std::ranges::equal(sv, std::views::iota(500, 503)));
+}
@@ -0,0 +1,87 @@
+/**
+ * @file test_aligned_split.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/aligned_split.hpp"
+#include "dd/slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace
+{
+auto is_aligned(void const* ptr, std::size_t alignment) -> bool
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+} // namespace
+
+TEST_CASE("aligned_split: splits a slice into head, body and tail", "[aligned_split]")
+{
+  alignas(64) auto data = std::array<float, 100>{};
+  std::iota(data.begin(), data.end(), 0.0f);
+
+  auto slice = data | dd::views::slice(3, 90);
+  auto parts = dd::ranges::aligned_split<64>(slice);
+
+  // 16 floats fit in 64 bytes, and the slice starts 3 floats past an aligned address.
+  REQUIRE(parts.lanes == 16);
+  REQUIRE(parts.head.size() == 13);
+  REQUIRE(parts.body.size() == 64);
+  REQUIRE(parts.tail.size() == 10);
+  REQUIRE(is_aligned(parts.body.data(), 64));
+  REQUIRE(parts.body_data() == parts.body.data());
+
+  // The parts are consecutive and cover the slice.
+  REQUIRE(parts.head.data() == slice.data());
+  REQUIRE(parts.body.data() == parts.head.data() + parts.head.size());
+  REQUIRE(parts.tail.data() == parts.body.data() + parts.body.size());
+  REQUIRE(parts.tail.data() + parts.tail.size() == slice.data() + slice.size());
+}
+
+TEST_CASE("aligned_split: aligned and short slices", "[aligned_split]")
+{
+  alignas(32) auto data = std::array<double, 20>{};
+
+  auto aligned = dd::ranges::aligned_split<32>(std::span{data});
+  REQUIRE(aligned.head.empty());
+  REQUIRE(aligned.body.size() == 20);
+  REQUIRE(aligned.tail.empty());
+
+  // The slice ends before the first aligned element.
+  auto short_slice = dd::ranges::aligned_split<32>(std::span{data}.subspan(1, 2));
+  REQUIRE(short_slice.head.size() == 2);
+  REQUIRE(short_slice.body.empty());
+  REQUIRE(short_slice.tail.empty());
+
+  auto empty = dd::ranges::aligned_split<32>(std::span<double>{});
+  REQUIRE(empty.head.empty());
+  REQUIRE(empty.body.empty());
+  REQUIRE(empty.tail.empty());
+}
+
+TEST_CASE("aligned_split: accepts contiguous slice views", "[aligned_split][slice_view]")
+{
+  auto v = std::vector<int>(256);
+  auto sv = dd::ranges::slice_view{v, 5, 200};
+  auto parts = dd::ranges::aligned_split<16>(sv);
+  REQUIRE(parts.head.size() + parts.body.size() + parts.tail.size() == 195);
+  REQUIRE(parts.body.size() % 4 == 0);
+  REQUIRE(parts.tail.size() < 4);
+  if (!parts.body.empty())
+  {
+    REQUIRE(is_aligned(parts.body.data(), 16));
+  }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file test_checkpoint_index.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/checkpoint_index.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <list>
+#include <ranges>
+
+TEST_CASE("checkpoint_index: locates positions of a list", "[checkpoint_index]")
+{
+  auto lst = std::list<int>{};
+  for (auto i = 0; i < 100; ++i)
+  {
+    lst.push_back(i);
+  }
+
+  auto index = dd::ranges::checkpoint_index(lst, 8);
+  REQUIRE(*index.locate(0) == 0);
+  REQUIRE(*index.locate(42) == 42);
+  REQUIRE(*index.locate(99) == 99);
+  REQUIRE(index.locate(150) == lst.end());
+  REQUIRE(index.size() == 100);
+}
+
+TEST_CASE(
+  "checkpoint_index: slices cost at most one interval to locate",
+  "[checkpoint_index][slice_view]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 1000) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+
+  auto index = dd::ranges::checkpoint_index(counted, 16);
+  auto first_page = dd::ranges::slice_view(index, 500, 505);
+  REQUIRE(std::ranges::equal(first_page, std::array{500, 501, 502, 503, 504}));
+
+  // Any later slice starts from the nearest checkpoint.
+  increments = 0;
+  auto second_page = dd::ranges::slice_view(index, 300, 303);
+  [[maybe_unused]] auto first = second_page.begin();
+  [[maybe_unused]] auto last = second_page.end();
+  REQUIRE(increments <= 2 * index.interval());
+  REQUIRE(std::ranges::equal(second_page, std::array{300, 301, 302}));
+}
+
+TEST_CASE(
+  "checkpoint_index: slices refer to the base of the index",
+  "[checkpoint_index][slice_view]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto is_even = [](int x) { return x % 2 == 0; };
+  auto index = dd::ranges::checkpoint_index(lst | std::views::filter(is_even), 2);
+  using filtered_ref = std::ranges::ref_view<decltype(index)::base_type>;
+
+  // The located iterators are iterators of the filter_view held by the index.
+  auto page = dd::ranges::slice_view(index, 1, 4);
+  STATIC_REQUIRE(std::same_as<decltype(page), dd::ranges::slice_view<filtered_ref>>);
+  REQUIRE(&page.base().base() == &index.slice_base().base());
+  REQUIRE(std::ranges::equal(page, std::array{2, 4, 6}));
+}
+
+TEST_CASE("checkpoint_index: from-end slices", "[checkpoint_index][slice_view]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto index = dd::ranges::checkpoint_index(lst, 4);
+
+  auto tail = dd::ranges::slice_view(index, -3, dd::ranges::from_end(0));
+  REQUIRE(std::ranges::equal(tail, std::array{7, 8, 9}));
+  REQUIRE(std::ranges::empty(dd::ranges::slice_view(index, 8, -5)));
+}
+
+TEST_CASE("checkpoint_index: invalidation", "[checkpoint_index]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto index = dd::ranges::checkpoint_index(lst, 4);
+  REQUIRE(index.size() == 10);
+
+  // Inserting in the middle keeps the first checkpoints valid.
+  lst.insert(std::ranges::next(lst.begin(), 6), 42);
+  index.invalidate_from(6);
+  REQUIRE(index.checkpoint_count() == 2);
+  REQUIRE(*index.locate(6) == 42);
+  REQUIRE(index.size() == 11);
+
+  // Inserting at the front changes every position.
+  lst.push_front(-1);
+  index.invalidate();
+  REQUIRE(index.checkpoint_count() == 0);
+  REQUIRE(std::ranges::equal(dd::ranges::slice_view(index, 0, 2), std::array{-1, 0}));
+}
@@ -0,0 +1,105 @@
+/**
+ * @file test_compact_slice_view.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/compact_slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <cstdint>
+#include <forward_list>
+#include <list>
+#include <ranges>
+
+namespace
+{
+using list_view = std::ranges::ref_view<std::list<int>>;
+using forward_list_view = std::ranges::ref_view<std::forward_list<int>>;
+
+// The indices share their storage with the cached iterators, so a compact slice holds
+// the base, two iterators, the length and one state byte.
+static_assert(
+  sizeof(dd::ranges::compact_slice_view<list_view>) <
+  sizeof(dd::ranges::slice_view<list_view>));
+static_assert(
+  sizeof(dd::ranges::compact_slice_view<forward_list_view>) <
+  sizeof(dd::ranges::slice_view<forward_list_view>));
+static_assert(
+  sizeof(dd::ranges::compact_slice_view<list_view>) <=
+  sizeof(list_view) + 2 * sizeof(std::list<int>::iterator) + sizeof(std::uint64_t));
+static_assert(
+  sizeof(dd::ranges::compact_slice_view<list_view, std::int64_t>) <=
+  sizeof(list_view) + 3 * sizeof(std::list<int>::iterator) + sizeof(std::uint64_t));
+} // namespace
+
+TEST_CASE("compact_slice_view: slices a borrowed forward range", "[compact_slice_view]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto slice = dd::ranges::compact_slice_view(lst, 2, 5);
+  STATIC_REQUIRE(std::ranges::bidirectional_range<decltype(slice)>);
+  STATIC_REQUIRE(std::ranges::borrowed_range<decltype(slice)>);
+  STATIC_REQUIRE(std::same_as<decltype(slice)::index_type, std::uint32_t>);
+
+  // The size of a sized base is computed from the stored indices.
+  REQUIRE(slice.size() == 3);
+  REQUIRE_FALSE(slice.is_located());
+
+  REQUIRE(std::ranges::equal(slice, std::array{2, 3, 4}));
+  REQUIRE(slice.is_located());
+  REQUIRE(slice.size() == 3);
+}
+
+TEST_CASE("compact_slice_view: bounds and from_end", "[compact_slice_view][bounds]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto past_end = dd::ranges::compact_slice_view(lst, 8, 20);
+  REQUIRE(past_end.size() == 2);
+  REQUIRE(std::ranges::equal(past_end, std::array{8, 9}));
+
+  auto to_end = dd::ranges::compact_slice_view(lst, 7, dd::ranges::from_end(0));
+  REQUIRE(std::ranges::equal(to_end, std::array{7, 8, 9}));
+
+  auto from_end = dd::ranges::compact_slice_view<list_view, std::int32_t>(lst, -4, -1);
+  REQUIRE(from_end.size() == 3);
+  REQUIRE(std::ranges::equal(from_end, std::array{6, 7, 8}));
+
+  auto empty = dd::ranges::compact_slice_view(lst, 12, 15);
+  REQUIRE(std::ranges::empty(empty));
+}
+
+TEST_CASE("compact_slice_view: unsized bases", "[compact_slice_view]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto slice = dd::ranges::compact_slice_view(fl, 3, 7);
+  REQUIRE(slice.size() == 4);
+  REQUIRE(slice.is_located());
+  REQUIRE(std::ranges::equal(slice, std::array{3, 4, 5, 6}));
+
+  auto clamped = dd::ranges::compact_slice_view(fl, 8, 20);
+  REQUIRE(clamped.size() == 2);
+}
+
+TEST_CASE(
+  "compact_slice_view: pre-located iterators and copies", "[compact_slice_view][cache]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto first = std::ranges::next(fl.begin(), 4);
+  auto last = std::ranges::next(first, 3);
+  auto seeded = dd::ranges::compact_slice_view<forward_list_view>(fl, 4, 7, first, last);
+  REQUIRE(seeded.is_located());
+  REQUIRE(std::ranges::equal(seeded, std::array{4, 5, 6}));
+  REQUIRE(seeded.size() == 3);
+
+  // Copies keep the located iterators, which are iterators of the borrowed base.
+  auto copy = seeded;
+  REQUIRE(copy.is_located());
+  REQUIRE(copy.begin() == first);
+}
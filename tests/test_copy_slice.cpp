@@ -0,0 +1,71 @@
+/**
+ * @file test_copy_slice.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/copy_slice.hpp"
+#include "dd/slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <string>
+#include <vector>
+
+TEST_CASE("copy_slice: copies slices of any range", "[copy_slice]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7};
+  auto out = std::array<int, 4>{};
+
+  // Contiguous slices of trivially copyable elements are copied by memcpy.
+  auto contiguous = dd::ranges::slice_view(v, 2, 6);
+  STATIC_REQUIRE(dd::ranges::detail::memcpy_copyable<decltype(contiguous), int*>);
+  auto [in, last] = dd::ranges::copy_slice(contiguous, out.data());
+  REQUIRE(in == v.begin() + 6);
+  REQUIRE(last == out.data() + 4);
+  REQUIRE(out == std::array{2, 3, 4, 5});
+
+  // Random access slices are copied with a known count.
+  auto d = std::deque{0, 1, 2, 3, 4, 5, 6, 7};
+  auto random_access = dd::ranges::slice_view(d, 1, 4);
+  auto result = dd::ranges::copy_slice(random_access, out.begin());
+  REQUIRE(result.out == out.begin() + 3);
+  REQUIRE(out == std::array{1, 2, 3, 5});
+
+  auto fl = std::forward_list<std::string>{"a", "b", "c"};
+  auto strings = std::vector<std::string>(2);
+  dd::ranges::copy_slice(fl | dd::views::slice(1, 3), strings.begin());
+  REQUIRE(strings == std::vector<std::string>{"b", "c"});
+
+  constexpr auto copied = []
+  {
+    auto source = std::array{1, 2, 3, 4};
+    auto target = std::array<int, 2>{};
+    dd::ranges::copy_slice(source | dd::views::slice(2, 4), target.begin());
+    return target;
+  }();
+  STATIC_REQUIRE(copied == std::array{3, 4});
+}
+
+TEST_CASE("slice_to: materializes slices into containers", "[copy_slice]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7};
+  auto copied = dd::ranges::slice_to<std::vector>(dd::ranges::slice_view(v, 3, 7));
+  REQUIRE(copied == std::vector{3, 4, 5, 6});
+
+  auto lst = std::list{0, 1, 2, 3, 4};
+  auto from_list = dd::ranges::slice_to<std::vector<int>>(lst | dd::views::slice(1, 3));
+  REQUIRE(from_list == std::vector{1, 2});
+
+  auto as_deque = dd::ranges::slice_to<std::deque>(v | dd::views::slice(6, 10));
+  REQUIRE(as_deque == std::deque{6, 7});
+}
@@ -0,0 +1,146 @@
+/**
+ * @file test_mapped_records.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/mapped_records.hpp"
+#include "dd/slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct record
+{
+  std::int64_t id;
+  double value;
+};
+
+/**
+ * @brief A temporary file, removed on destruction.
+ */
+struct temporary_file
+{
+  std::filesystem::path path;
+
+  explicit temporary_file(char const* name)
+      : path{std::filesystem::temp_directory_path() / name}
+  {
+  }
+
+  ~temporary_file() { std::filesystem::remove(path); }
+};
+
+auto write_records(std::filesystem::path const& path, std::size_t count) -> void
+{
+  auto out = std::ofstream(path, std::ios::binary | std::ios::trunc);
+  for (auto i = std::size_t{0}; i < count; ++i)
+  {
+    const auto r = record{static_cast<std::int64_t>(i), static_cast<double>(i) / 2};
+    out.write(reinterpret_cast<char const*>(&r), sizeof(r));
+  }
+}
+
+/**
+ * @brief A contiguous range that counts the span slices it is notified of.
+ */
+struct advised_buffer
+{
+  std::array<int, 8> elements{0, 1, 2, 3, 4, 5, 6, 7};
+  inline static std::vector<std::pair<int, std::size_t>> advised;
+
+  auto begin() const { return elements.data(); }
+  auto end() const { return elements.data() + elements.size(); }
+};
+} // namespace
+
+template <>
+struct dd::ranges::span_slice_traits<advised_buffer>
+{
+  static auto advise(std::span<int const> s) -> void
+  {
+    advised_buffer::advised.emplace_back(s.empty() ? -1 : s.front(), s.size());
+  }
+};
+
+TEST_CASE("mapped_records: slices are spans over the mapping", "[mapped_records]")
+{
+  auto file = temporary_file{"dd_test_mapped_records.bin"};
+  write_records(file.path, 10'000);
+
+  const auto records = dd::ranges::mapped_records<record>(file.path);
+  STATIC_REQUIRE(std::ranges::contiguous_range<decltype(records)>);
+  REQUIRE(records.size() == 10'000);
+  REQUIRE(records[9'999].id == 9'999);
+
+  auto slice = records | dd::views::slice(4'000, 4'010);
+  STATIC_REQUIRE(std::is_same_v<decltype(slice), std::span<record const>>);
+  REQUIRE(slice.size() == 10);
+  REQUIRE(slice.data() == records.data() + 4'000);
+  REQUIRE(slice.front().id == 4'000);
+  REQUIRE(slice.back().value == 4'009 / 2.0);
+
+  // Indices are clamped and counted from the end as for any slice.
+  REQUIRE((records | dd::views::slice(-3, dd::ranges::from_end(0))).front().id == 9'997);
+  REQUIRE((records | dd::views::slice(9'990, 20'000)).size() == 10);
+  REQUIRE((records | dd::views::slice(20'000, 30'000)).empty());
+}
+
+TEST_CASE("mapped_records: ownership of the mapping", "[mapped_records]")
+{
+  auto file = temporary_file{"dd_test_mapped_records_move.bin"};
+  write_records(file.path, 3);
+  {
+    // Trailing bytes of a partial record are ignored.
+    auto out = std::ofstream(file.path, std::ios::binary | std::ios::app);
+    out.put('x');
+  }
+
+  auto records = dd::ranges::mapped_records<record>(file.path);
+  REQUIRE(records.size() == 3);
+
+  auto moved = std::move(records);
+  REQUIRE(records.empty());
+  REQUIRE(moved.size() == 3);
+  REQUIRE(moved[2].id == 2);
+
+  auto empty = temporary_file{"dd_test_mapped_records_empty.bin"};
+  write_records(empty.path, 0);
+  moved = dd::ranges::mapped_records<record>(empty.path);
+  REQUIRE(moved.empty());
+  REQUIRE((moved | dd::views::slice(0, 5)).empty());
+
+  REQUIRE_THROWS_AS(
+    dd::ranges::mapped_records<record>(file.path.parent_path() / "dd_no_such_file"),
+    std::system_error);
+}
+
+TEST_CASE("span_slice_traits: span slices notify the range", "[mapped_records]")
+{
+  advised_buffer::advised.clear();
+  const auto buffer = advised_buffer{};
+
+  auto slice = buffer | dd::views::slice(2, 5);
+  REQUIRE(std::ranges::equal(slice, std::array{2, 3, 4}));
+  REQUIRE(advised_buffer::advised == std::vector<std::pair<int, std::size_t>>{{2, 3}});
+
+  auto empty = buffer | dd::views::slice(6, 2);
+  REQUIRE(empty.empty());
+  REQUIRE(advised_buffer::advised.back() == std::pair<int, std::size_t>{-1, 0});
+}
@@ -0,0 +1,87 @@
+/**
+ * @file test_multi_slice_view.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/multi_slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <vector>
+
+TEST_CASE("multi_slice_view: slices in the given order", "[multi_slice_view]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto msv = dd::ranges::multi_slice_view(lst, {{6, 8}, {1, 3}, {2, 5}});
+  STATIC_REQUIRE(std::ranges::random_access_range<decltype(msv)>);
+  STATIC_REQUIRE(std::ranges::sized_range<decltype(msv)>);
+
+  REQUIRE(msv.size() == 3);
+  REQUIRE(std::ranges::equal(msv[0], std::array{6, 7}));
+  REQUIRE(std::ranges::equal(msv[1], std::array{1, 2}));
+  REQUIRE(std::ranges::equal(msv[2], std::array{2, 3, 4}));
+}
+
+TEST_CASE(
+  "multi_slice_view: boundaries are located in one sweep", "[multi_slice_view][cache]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 100) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+
+  auto msv = dd::ranges::multi_slice_view(counted, {{50, 55}, {10, 20}, {30, 40}});
+  [[maybe_unused]] auto first = msv.begin();
+
+  // One pass to the largest ending index: begin() of the filter and 55 increments.
+  REQUIRE(increments == 56);
+
+  // The slices are seeded with the located iterators, and do not walk the base.
+  REQUIRE(*msv[0].begin() == 50);
+  REQUIRE(*msv[1].end() == 20);
+  REQUIRE(*msv[2].begin() == 30);
+  REQUIRE(increments == 56);
+}
+
+TEST_CASE("multi_slice_view: join() flattens the slices", "[multi_slice_view]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto msv = fl | dd::views::multi_slice({{0, 2}, {5, 7}, {8, 20}});
+
+  auto expected = std::array{0, 1, 5, 6, 8, 9};
+  REQUIRE(std::ranges::equal(msv.join(), expected));
+}
+
+TEST_CASE(
+  "multi_slice_view: negative and out of range indices", "[multi_slice_view][bounds]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto msv = dd::ranges::multi_slice_view(
+    fl, {{-3, dd::ranges::from_end(0)}, {-5, -4}, {12, 15}, {4, 2}});
+
+  REQUIRE(std::ranges::equal(msv[0], std::array{7, 8, 9}));
+  REQUIRE(std::ranges::equal(msv[1], std::array{5}));
+  REQUIRE(std::ranges::empty(msv[2]));
+  REQUIRE(std::ranges::empty(msv[3]));
+}
+
+TEST_CASE("multi_slice_view: copies locate the slices again", "[multi_slice_view][cache]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5};
+  auto msv = dd::ranges::multi_slice_view(v, {{1, 3}});
+  REQUIRE(std::ranges::equal(msv[0], std::array{1, 2}));
+
+  auto copy = msv;
+  REQUIRE(std::ranges::equal(copy[0], std::array{1, 2}));
+  REQUIRE(copy[0].base().data() == v.data());
+}
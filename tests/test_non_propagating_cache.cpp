@@ -12,4 +12,132 @@
 
 #include "catch2/catch_test_macros.hpp"
 
-TEST_CASE("non_propagating_cache: placeholder", "[placeholder]") { REQUIRE(true); }
+#include <any>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST_CASE("non_propagating_cache: copies and moves do not propagate", "[cache]")
+{
+  auto cache = dd::non_propagating_cache<int>{};
+  cache.emplace(42);
+  REQUIRE(cache.has_value());
+
+  // Copying resets the destination and leaves the source unchanged.
+  auto copy = cache;
+  REQUIRE(!copy.has_value());
+  REQUIRE(cache.value() == 42);
+
+  // Moving resets both the source and the destination.
+  auto moved = std::move(cache);
+  REQUIRE(!moved.has_value());
+  REQUIRE(!cache.has_value());
+}
+
+TEST_CASE("non_propagating_cache: get_or_emplace fills once", "[cache]")
+{
+  auto calls = 0;
+  auto cache = dd::non_propagating_cache<int>{};
+
+  REQUIRE(cache.get_or_emplace([&] { return ++calls; }) == 1);
+  REQUIRE(cache.get_or_emplace([&] { return ++calls; }) == 1);
+  REQUIRE(calls == 1);
+}
+
+namespace
+{
+/**
+ * @brief Counts its copies and moves.
+ */
+struct copy_counter
+{
+  explicit copy_counter(int& copies) : copies_{&copies} {}
+  copy_counter(copy_counter const& other) : copies_{other.copies_} { ++*copies_; }
+  copy_counter(copy_counter&& other) noexcept : copies_{other.copies_} { ++*copies_; }
+  auto operator=(copy_counter const&) -> copy_counter& = default;
+  auto operator=(copy_counter&&) noexcept -> copy_counter& = default;
+
+  int* copies_;
+};
+} // namespace
+
+TEST_CASE("non_propagating_cache: get_or_emplace constructs in place", "[cache]")
+{
+  auto copies = 0;
+  auto cache = dd::non_propagating_cache<copy_counter>{};
+  cache.get_or_emplace([&] { return copy_counter{copies}; });
+  REQUIRE(cache.has_value());
+  REQUIRE(copies == 0);
+
+  auto concurrent = dd::non_propagating_cache<copy_counter, dd::concurrent_tag>{};
+  concurrent.get_or_emplace([&] { return copy_counter{copies}; });
+  REQUIRE(concurrent.has_value());
+  REQUIRE(copies == 0);
+}
+
+TEST_CASE("non_propagating_cache: get_or_emplace of a type from any value", "[cache]")
+{
+  // std::any is constructible from the deferred invocation itself, so the result of
+  // the invocable is moved into the cache instead.
+  STATIC_REQUIRE(!dd::detail::elides_through_conversion<std::any, std::any (*)()>);
+
+  auto cache = dd::non_propagating_cache<std::any>{};
+  auto& value = cache.get_or_emplace([] { return std::any{42}; });
+  REQUIRE(std::any_cast<int>(value) == 42);
+
+  auto concurrent = dd::non_propagating_cache<std::any, dd::concurrent_tag>{};
+  REQUIRE(std::any_cast<int>(concurrent.get_or_emplace([] { return std::any{7}; })) == 7);
+}
+
+TEST_CASE(
+  "non_propagating_cache: concurrent copies and moves do not propagate",
+  "[cache][concurrent]")
+{
+  auto cache = dd::non_propagating_cache<int, dd::concurrent_tag>{};
+  cache.emplace(42);
+  REQUIRE(cache.has_value());
+
+  auto copy = cache;
+  REQUIRE(!copy.has_value());
+  REQUIRE(*cache == 42);
+
+  auto moved = std::move(cache);
+  REQUIRE(!moved.has_value());
+  REQUIRE(!cache.has_value());
+}
+
+TEST_CASE(
+  "non_propagating_cache: concurrent get_or_emplace is invoked once",
+  "[cache][concurrent]")
+{
+  constexpr auto thread_count = 8;
+
+  auto calls = std::atomic<int>{0};
+  auto cache = dd::non_propagating_cache<int, dd::concurrent_tag>{};
+  auto results = std::vector<int>(thread_count);
+
+  {
+    auto threads = std::vector<std::jthread>{};
+    for (auto i = 0; i < thread_count; ++i)
+    {
+      threads.emplace_back(
+        [&, i]
+        {
+          results[i] = cache.get_or_emplace(
+            [&]
+            {
+              ++calls;
+              return 42;
+            });
+        });
+    }
+  }
+
+  REQUIRE(calls == 1);
+  REQUIRE(cache.has_value());
+  for (auto result : results)
+  {
+    REQUIRE(result == 42);
+  }
+}
@@ -0,0 +1,95 @@
+/**
+ * @file test_parallel_for_each.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/parallel_for_each.hpp"
+#include "dd/slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("parallel_for_each: visits every element once", "[parallel_for_each]")
+{
+  auto v = std::vector<long>(10000);
+  std::iota(v.begin(), v.end(), 0);
+  auto sum = std::atomic<long>{0};
+  auto add = [&](long x) { sum += x; };
+
+  // Random access slices are chunked by arithmetic.
+  dd::ranges::parallel_for_each(dd::ranges::slice_view(v, 100, 9100), add, 4);
+  REQUIRE(sum == (100 + 9099) * 9000 / 2);
+
+  // Forward slices are chunked by a single walk, while the workers run.
+  auto fl = std::forward_list<long>(v.begin(), v.end());
+  sum = 0;
+  dd::ranges::parallel_for_each(fl | dd::views::slice(0, 5000), add, 4, 64);
+  REQUIRE(sum == 4999 * 5000 / 2);
+
+  // A single thread processes the elements in order.
+  auto visited = std::vector<long>{};
+  dd::ranges::parallel_for_each(
+    fl | dd::views::slice(10, 13), [&](long x) { visited.push_back(x); }, 1);
+  REQUIRE(visited == std::vector<long>{10, 11, 12});
+}
+
+TEST_CASE("parallel_for_each: stress of small chunks", "[parallel_for_each][stress]")
+{
+  // Many more workers than cores, stealing chunks of one element while they are still
+  // being produced, so that claimed chunks are often taken by other workers first.
+  constexpr auto size = 20000;
+  const auto threads = std::max(std::thread::hardware_concurrency(), 1U) * 4 + 1;
+  auto fl = std::forward_list<int>(size);
+  std::iota(fl.begin(), fl.end(), 0);
+  auto v = std::vector<int>(fl.begin(), fl.end());
+
+  for (auto round = 0; round < 20; ++round)
+  {
+    auto visits = std::vector<std::atomic<int>>(size);
+    auto visit = [&](int x) { ++visits[static_cast<std::size_t>(x)]; };
+    dd::ranges::parallel_for_each(fl, visit, threads, 1);
+    dd::ranges::parallel_for_each(v, visit, threads, 1);
+    REQUIRE(std::ranges::all_of(visits, [](auto const& n) { return n == 2; }));
+  }
+}
+
+TEST_CASE("parallel_for_each: mutates the elements of a slice", "[parallel_for_each]")
+{
+  auto lst = std::list<int>(2000, 1);
+  auto front = lst | dd::views::slice(0, 1000);
+  dd::ranges::parallel_for_each(front, [](int& x) { x = 2; }, 3, 10);
+  REQUIRE(std::accumulate(lst.begin(), lst.end(), 0) == 1000 * 2 + 1000);
+  REQUIRE(lst.front() == 2);
+  REQUIRE(lst.back() == 1);
+}
+
+TEST_CASE("parallel_for_each: rethrows the first exception", "[parallel_for_each]")
+{
+  auto v = std::vector<int>(1000);
+  std::iota(v.begin(), v.end(), 0);
+  auto fl = std::forward_list<int>(v.begin(), v.end());
+  auto thrower = [](int x)
+  {
+    if (x == 500)
+    {
+      throw std::runtime_error("element 500");
+    }
+  };
+  REQUIRE_THROWS_AS(dd::ranges::parallel_for_each(v, thrower, 4), std::runtime_error);
+  REQUIRE_THROWS_AS(
+    dd::ranges::parallel_for_each(fl, thrower, 4, 16), std::runtime_error);
+}
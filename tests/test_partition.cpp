@@ -0,0 +1,82 @@
+/**
+ * @file test_partition.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/partition.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <list>
+#include <ranges>
+#include <vector>
+
+TEST_CASE("partition: balanced sub-slices of a list", "[partition]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto sv = lst | dd::views::slice(1, 9);
+
+  auto pieces = dd::ranges::partition(sv, 3);
+  REQUIRE(pieces.size() == 3);
+  REQUIRE(std::ranges::equal(pieces[0], std::array{1, 2, 3}));
+  REQUIRE(std::ranges::equal(pieces[1], std::array{4, 5, 6}));
+  REQUIRE(std::ranges::equal(pieces[2], std::array{7, 8}));
+  REQUIRE(pieces[2].size() == 2);
+}
+
+TEST_CASE("partition: sub-slices do not walk the base again", "[partition][cache]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 100) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+  auto sv = counted | dd::views::slice(10, 20);
+
+  auto pieces = dd::ranges::partition(sv, 4);
+  const auto after_split = increments;
+  for (auto& piece : pieces)
+  {
+    [[maybe_unused]] auto first = piece.begin();
+    [[maybe_unused]] auto last = piece.end();
+  }
+  REQUIRE(increments == after_split);
+
+  REQUIRE(std::ranges::equal(pieces[0], std::array{10, 11, 12}));
+  REQUIRE(std::ranges::equal(pieces[1], std::array{13, 14, 15}));
+  REQUIRE(std::ranges::equal(pieces[2], std::array{16, 17}));
+  REQUIRE(std::ranges::equal(pieces[3], std::array{18, 19}));
+}
+
+TEST_CASE("partition: more pieces than elements", "[partition][bounds]")
+{
+  auto lst = std::list{0, 1, 2};
+  auto sv = lst | dd::views::slice(-2, dd::ranges::from_end(0));
+
+  auto pieces = dd::ranges::partition(sv, 4);
+  REQUIRE(pieces.size() == 4);
+  REQUIRE(std::ranges::equal(pieces[0], std::array{1}));
+  REQUIRE(std::ranges::equal(pieces[1], std::array{2}));
+  REQUIRE(std::ranges::empty(pieces[2]));
+  REQUIRE(std::ranges::empty(pieces[3]));
+}
+
+TEST_CASE(
+  "partition: balanced sub-spans of a contiguous slice", "[partition][contiguous]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto pieces = dd::ranges::partition(v | dd::views::slice(0, 10), 3);
+  REQUIRE(pieces.size() == 3);
+  REQUIRE(pieces[0].data() == v.data());
+  REQUIRE(std::ranges::equal(pieces[0], std::array{0, 1, 2, 3}));
+  REQUIRE(std::ranges::equal(pieces[1], std::array{4, 5, 6}));
+  REQUIRE(std::ranges::equal(pieces[2], std::array{7, 8, 9}));
+}
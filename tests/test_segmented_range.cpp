@@ -0,0 +1,145 @@
+/**
+ * @file test_segmented_range.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/segmented_range.hpp"
+#include "dd/slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <ranges>
+#include <vector>
+
+namespace test
+{
+/**
+ * @brief A user-defined segmented container.
+ */
+class sharded_buffer : public std::ranges::view_interface<sharded_buffer>
+{
+public:
+  explicit sharded_buffer(std::vector<std::vector<int>>& shards)
+      : shards_{&shards}, joined_{std::views::join(shards)}
+  {
+  }
+
+  auto begin() { return joined_.begin(); }
+
+  auto end() { return joined_.end(); }
+
+  auto shards() const -> std::vector<std::vector<int>>& { return *shards_; }
+
+private:
+  std::vector<std::vector<int>>* shards_;
+  std::ranges::join_view<std::ranges::ref_view<std::vector<std::vector<int>>>> joined_;
+};
+} // namespace test
+
+template <>
+struct dd::ranges::segmented_range_traits<test::sharded_buffer>
+{
+  static auto segments(test::sharded_buffer const& buffer)
+  {
+    return std::views::all(buffer.shards());
+  }
+};
+
+TEST_CASE("segmented_range: join views of sized random access ranges", "[segmented]")
+{
+  auto shards = std::vector<std::vector<int>>{{0, 1}, {}, {2, 3, 4}, {5}};
+  auto joined = shards | std::views::join;
+  STATIC_REQUIRE(dd::ranges::segmented_range<decltype(joined)&>);
+
+  // Owning join views keep their segments, so slicing them cannot skip segments.
+  auto owning = std::views::join(std::vector<std::vector<int>>{{0}});
+  STATIC_REQUIRE(!dd::ranges::segmented_range<decltype(owning)&>);
+
+  STATIC_REQUIRE(!dd::ranges::segmented_range<std::vector<int>&>);
+}
+
+TEST_CASE("segmented_range: owning prvalue segments are not skipped", "[segmented]")
+{
+  // The segments are destroyed once read, so iterators into them would dangle, even
+  // though the range of segments is a borrowed ref_view.
+  auto segment = [](int i) { return std::vector{i * 10, i * 10 + 1}; };
+  auto owned = std::views::iota(0, 3) | std::views::transform(segment);
+  auto joined = std::views::join(std::ranges::ref_view(owned));
+  STATIC_REQUIRE(std::ranges::borrowed_range<decltype(joined.base())>);
+  STATIC_REQUIRE(!dd::ranges::segmented_range<decltype(joined)&>);
+
+  // Slices of such join views are generic slices.
+  auto sv = joined | dd::views::slice(1, 4);
+  STATIC_REQUIRE(dd::ranges::detail::is_slice_view<decltype(sv)>);
+  REQUIRE(std::ranges::equal(sv, std::array{1, 10, 11}));
+}
+
+TEST_CASE("segmented_range: slices skip and trim segments", "[segmented][slice_view]")
+{
+  auto shards = std::vector<std::vector<int>>{{0, 1}, {}, {2, 3, 4}, {5}};
+  auto joined = shards | std::views::join;
+
+  REQUIRE(std::ranges::equal(joined | dd::views::slice(1, 5), std::array{1, 2, 3, 4}));
+  REQUIRE(std::ranges::equal(joined | dd::views::slice(3, 4), std::array{3}));
+  REQUIRE(std::ranges::equal(joined | dd::views::slice(4, 100), std::array{4, 5}));
+  REQUIRE(std::ranges::empty(joined | dd::views::slice(6, 10)));
+  REQUIRE(std::ranges::empty(joined | dd::views::slice(4, 2)));
+
+  // Negative indices are resolved against the sum of the segment sizes.
+  REQUIRE(std::ranges::equal(
+    joined | dd::views::slice(-3, dd::ranges::from_end(0)), std::array{3, 4, 5}));
+  REQUIRE(std::ranges::equal(joined | dd::views::slice(-5, -3), std::array{1, 2}));
+
+  // The slice refers to the elements of the segments.
+  auto sv = joined | dd::views::slice(2, 4);
+  std::ranges::for_each(sv, [](int& x) { x *= 10; });
+  REQUIRE(shards[2] == std::vector{20, 30, 4});
+
+  // Policies that segmented slices do not implement keep the generic slice_view.
+  using policy = dd::ranges::concurrent_slice_policy;
+  auto concurrent = joined | dd::views::slice_with<policy>(1, 3);
+  STATIC_REQUIRE(std::same_as<decltype(concurrent)::policy_type, policy>);
+  REQUIRE(std::ranges::equal(concurrent, std::array{1, 20}));
+}
+
+TEST_CASE("segmented_range: positioning visits segments only", "[segmented][slice_view]")
+{
+  auto segment_reads = 0;
+  auto joined = std::views::iota(0, 100) | std::views::transform(
+                                             [&](int i)
+                                             {
+                                               ++segment_reads;
+                                               return std::views::iota(
+                                                 i * 1000, (i + 1) * 1000);
+                                             }) |
+                std::views::join;
+
+  // Nothing is read until the slice is iterated, and the slice is then located once.
+  auto sv = joined | dd::views::slice(12345, 12350);
+  using joined_ref = std::ranges::ref_view<decltype(joined)>;
+  STATIC_REQUIRE(
+    std::same_as<decltype(sv), dd::ranges::segmented_slice_view<joined_ref>>);
+  REQUIRE(segment_reads == 0);
+  REQUIRE(sv.size() == 5);
+  REQUIRE(segment_reads == 13);
+  REQUIRE(std::ranges::equal(sv, std::views::iota(12345, 12350)));
+  REQUIRE(segment_reads == 13);
+}
+
+TEST_CASE("segmented_range: user-defined segmented ranges", "[segmented][slice_view]")
+{
+  auto shards = std::vector<std::vector<int>>{{0, 1, 2}, {3, 4, 5}, {6, 7, 8}};
+  auto buffer = test::sharded_buffer{shards};
+  STATIC_REQUIRE(dd::ranges::segmented_range<test::sharded_buffer&>);
+
+  auto sv = buffer | dd::views::slice(4, 7);
+  REQUIRE(std::ranges::equal(sv, std::array{4, 5, 6}));
+}
@@ -0,0 +1,107 @@
+/**
+ * @file test_slice2d_view.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/slice2d_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+TEST_CASE("slice2d_view: submatrix of a nested matrix", "[slice2d_view]")
+{
+  auto m =
+    std::vector<std::vector<int>>{{0, 1, 2, 3}, {10, 11, 12, 13}, {20, 21, 22, 23}};
+  auto sub = m | dd::views::slice2d({1, 3}, {1, 3});
+  STATIC_REQUIRE(std::ranges::forward_range<decltype(sub)>);
+  STATIC_REQUIRE(std::ranges::sized_range<decltype(sub)>);
+  REQUIRE(sub.rows() == 2);
+  REQUIRE(sub.cols() == 2);
+  REQUIRE(std::ranges::equal(sub, std::array{11, 12, 21, 22}));
+  REQUIRE(std::ranges::equal(sub.row(1), std::array{21, 22}));
+
+  sub[0, 1] = 99;
+  REQUIRE(m[1][2] == 99);
+
+  auto empty = m | dd::views::slice2d({1, 1}, {0, 2});
+  REQUIRE(empty.begin() == empty.end());
+}
+
+TEST_CASE("slice2d_view: flat buffers with a row stride", "[slice2d_view]")
+{
+  auto flat = std::vector<int>(12);
+  std::iota(flat.begin(), flat.end(), 0);
+
+  // A 3 x 4 matrix, without its first and last columns.
+  auto sub = flat | dd::views::slice2d({0, dd::ranges::from_end(0)}, {1, 3}, 4);
+  REQUIRE(sub.size() == 6);
+  REQUIRE(std::ranges::equal(sub, std::array{1, 2, 5, 6, 9, 10}));
+  REQUIRE(sub[2, 1] == 10);
+
+  // Negative indices count from the last row and from the stride.
+  auto corner = dd::ranges::slice2d_view(std::span(flat), {1, -1}, {-2, 4}, 4);
+  REQUIRE(std::ranges::equal(corner, std::array{6, 7}));
+}
+
+TEST_CASE("slice2d_view: flat buffers of ranges", "[slice2d_view]")
+{
+  // A 2 x 3 image of pixels in row-major order, whose elements are ranges themselves.
+  using pixel = std::array<float, 4>;
+  auto image = std::vector<pixel>(6);
+  for (auto i = std::size_t{0}; i < image.size(); ++i)
+  {
+    image[i].fill(static_cast<float>(i));
+  }
+  auto first_channel = [](pixel const& p) { return p[0]; };
+
+  // A stride selects the flat layout.
+  auto sub = image | dd::views::slice2d({0, 2}, {1, 3}, 3);
+  STATIC_REQUIRE(std::same_as<
+                 decltype(sub),
+                 dd::ranges::slice2d_view<
+                   std::ranges::ref_view<std::vector<pixel>>, dd::ranges::flat_tag>>);
+  REQUIRE(sub.size() == 4);
+  REQUIRE(sub[1, 0][0] == 4.0F);
+  REQUIRE(std::ranges::equal(
+    sub | std::views::transform(first_channel), std::array{1.0F, 2.0F, 4.0F, 5.0F}));
+
+  // Without a stride, the elements are the rows of a nested matrix.
+  auto channels = image | dd::views::slice2d({1, 3}, {2, 4});
+  REQUIRE(channels.rows() == 2);
+  REQUIRE(channels.cols() == 2);
+  REQUIRE(std::ranges::equal(channels, std::array{1.0F, 1.0F, 2.0F, 2.0F}));
+
+  auto names = std::vector<std::string>{"a", "b", "c", "d"};
+  auto column = dd::ranges::slice2d_view(names, {0, 2}, {1, 2}, 2);
+  REQUIRE(std::ranges::equal(column, std::array<std::string, 2>{"b", "d"}));
+}
+
+TEST_CASE("slice2d_view: tiled traversal", "[slice2d_view][tiles]")
+{
+  auto flat = std::vector<int>(12);
+  std::iota(flat.begin(), flat.end(), 0);
+  auto sub = flat | dd::views::slice2d({0, 3}, {1, 4}, 4);
+
+  // Tiles of 2 x 2, clipped at the right and bottom edges.
+  auto tiles = sub.tiles(2, 2);
+  REQUIRE(std::ranges::size(tiles) == 4);
+  REQUIRE(std::ranges::equal(tiles[0], std::array{1, 2, 5, 6}));
+  REQUIRE(std::ranges::equal(tiles[1], std::array{3, 7}));
+  REQUIRE(std::ranges::equal(tiles[3], std::array{11}));
+  REQUIRE(std::ranges::equal(
+    tiles | std::views::join, std::array{1, 2, 5, 6, 3, 7, 9, 10, 11}));
+}
@@ -14,7 +14,17 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <deque>
+#include <forward_list>
+#include <list>
 #include <ranges>
+#include <span>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 TEST_CASE("slice_view: basic slicing and size", "[slice_view][constexpr]")
 {
@@ -69,7 +79,7 @@ TEST_CASE(
   "[slice_view][base]")
 {
   auto v = std::array{1, 2, 3, 4, 5};
-  auto sv = v | dd::views::slice(0, 3);
+  auto sv = dd::ranges::slice_view{v, 0, 3};
 
   // base() returns a view of the underlying sequence; verify it iterates over the same
   // elements as the base container.
@@ -95,3 +105,607 @@ TEST_CASE(
   auto sv = dd::ranges::slice_view{v, 10, 10};
   REQUIRE(std::ranges::empty(sv));
 }
+
+TEST_CASE(
+  "slice_view: end() continues from the cached begin iterator", "[slice_view][cache]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 100) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+
+  // filter_view evaluates the predicate once in begin() and once per increment.
+  auto sv = dd::ranges::slice_view{counted, 5, 10};
+  auto first = sv.begin();
+  auto last = sv.end();
+  REQUIRE(increments == 11);
+  REQUIRE(*first == 5);
+  REQUIRE(*last == 10);
+
+  // Both iterators are cached, so repeated calls do not traverse the base.
+  REQUIRE(sv.begin() == first);
+  REQUIRE(sv.end() == last);
+  REQUIRE(increments == 11);
+}
+
+TEST_CASE(
+  "slice_view: calling end() first also caches begin()", "[slice_view][cache]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 100) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+
+  auto sv = dd::ranges::slice_view{counted, 5, 10};
+  [[maybe_unused]] auto last = sv.end();
+  REQUIRE(increments == 11);
+
+  REQUIRE(*sv.begin() == 5);
+  REQUIRE(increments == 11);
+}
+
+TEST_CASE(
+  "slice_view: size() of an unsized forward base is cached by end()",
+  "[slice_view][cache][size]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 100) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+
+  auto sv = dd::ranges::slice_view{counted, 5, 10};
+  STATIC_REQUIRE(std::ranges::sized_range<decltype(sv)>);
+
+  [[maybe_unused]] auto last = sv.end();
+  REQUIRE(increments == 11);
+  REQUIRE(sv.size() == 5);
+  REQUIRE(std::ranges::distance(sv) == 5);
+  REQUIRE(increments == 11);
+
+  // Calling size() first locates and caches both ends.
+  auto other = dd::ranges::slice_view{counted, 5, 10};
+  increments = 0;
+  REQUIRE(other.size() == 5);
+  REQUIRE(increments == 11);
+  REQUIRE(*other.begin() == 5);
+  REQUIRE(*other.end() == 10);
+  REQUIRE(increments == 11);
+}
+
+TEST_CASE(
+  "slice_view: size() of an unsized forward base is clamped",
+  "[slice_view][size][bounds]")
+{
+  auto fl = std::forward_list{10, 11, 12, 13, 14};
+  auto evens = fl | std::views::filter([](int x) { return x % 2 == 0; });
+
+  REQUIRE(dd::ranges::slice_view(evens, 1, 10).size() == 2);
+  REQUIRE(dd::ranges::slice_view(evens, 5, 10).size() == 0);
+  REQUIRE(dd::ranges::slice_view(evens, -2, dd::ranges::from_end(0)).size() == 2);
+
+  // The end of a bidirectional base is found by stepping back, so size() counts.
+  auto lst = std::list{10, 11, 12, 13, 14};
+  auto all = lst | std::views::filter([](int) { return true; });
+  REQUIRE(dd::ranges::slice_view(all, -4, -1).size() == 3);
+  REQUIRE(dd::ranges::slice_view(all, -2, 4).size() == 1);
+}
+
+TEST_CASE(
+  "slice_view: lazy-sentinel mode does not walk to the end", "[slice_view][lazy]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 100) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+
+  auto sv = counted | dd::views::lazy_slice(2, 5);
+  [[maybe_unused]] auto first = sv.begin();
+  [[maybe_unused]] auto last = sv.end();
+  REQUIRE(increments == 3);
+
+  auto expected = std::array{2, 3, 4};
+  REQUIRE(std::ranges::equal(sv, expected));
+}
+
+TEST_CASE(
+  "slice_view: lazy-sentinel mode clamps to the end of the base",
+  "[slice_view][lazy][bounds]")
+{
+  auto lst = std::list{10, 11, 12, 13, 14};
+
+  auto sv = lst | dd::views::lazy_slice(3, 10);
+  auto expected = std::array{13, 14};
+  REQUIRE(std::ranges::equal(sv, expected));
+
+  auto empty = lst | dd::views::lazy_slice(10, 10);
+  REQUIRE(std::ranges::empty(empty));
+}
+
+TEST_CASE("slice_view: single-pass input ranges are sliced", "[slice_view][input]")
+{
+  auto stream = std::istringstream{"0 1 2 3 4 5 6 7 8 9"};
+  auto numbers = std::views::istream<int>(stream);
+
+  auto sv = numbers | dd::views::slice(2, 5);
+  STATIC_REQUIRE(std::ranges::input_range<decltype(sv)>);
+  STATIC_REQUIRE(!std::ranges::forward_range<decltype(sv)>);
+
+  auto values = std::vector<int>{};
+  for (auto x : sv)
+  {
+    values.push_back(x);
+  }
+  REQUIRE(values == std::vector{2, 3, 4});
+
+  // The slice stops at the ending index, past which only the single value buffered by
+  // the istream_view was read.
+  auto next = 0;
+  stream >> next;
+  REQUIRE(next == 6);
+}
+
+TEST_CASE(
+  "slice_view: input range slices clamp to the end of the stream",
+  "[slice_view][input][bounds]")
+{
+  auto stream = std::istringstream{"0 1 2 3 4 5 6 7 8 9"};
+  auto numbers = std::views::istream<int>(stream);
+  auto values = std::vector<int>{};
+  for (auto x : numbers | dd::views::slice(7, 20))
+  {
+    values.push_back(x);
+  }
+  REQUIRE(values == std::vector{7, 8, 9});
+
+  auto other = std::istringstream{"0 1 2 3"};
+  auto rest = std::views::istream<int>(other);
+  values.clear();
+  for (auto x : rest | dd::views::slice(1, dd::ranges::from_end(0)))
+  {
+    values.push_back(x);
+  }
+  REQUIRE(values == std::vector{1, 2, 3});
+}
+
+TEST_CASE(
+  "slice_view: adaptor collapses contiguous ranges to a span", "[slice_view][contiguous]")
+{
+  auto v = std::vector{10, 11, 12, 13, 14};
+
+  auto sv = v | dd::views::slice(1, 4);
+  STATIC_REQUIRE(std::same_as<decltype(sv), std::span<int>>);
+  STATIC_REQUIRE(std::is_trivially_copyable_v<decltype(sv)>);
+  REQUIRE(sv.data() == v.data() + 1);
+
+  auto expected = std::array{11, 12, 13};
+  REQUIRE(std::ranges::equal(sv, expected));
+
+  const auto& cv = v;
+  STATIC_REQUIRE(
+    std::same_as<decltype(cv | dd::views::slice(1, 4)), std::span<const int>>);
+}
+
+TEST_CASE(
+  "slice_view: contiguous span slices clamp their bounds",
+  "[slice_view][contiguous][bounds]")
+{
+  auto v = std::vector{10, 11, 12, 13, 14};
+
+  auto expected = std::array{13, 14};
+  REQUIRE(std::ranges::equal(v | dd::views::slice(3, 10), expected));
+  REQUIRE(std::ranges::empty(v | dd::views::slice(10, 10)));
+}
+
+TEST_CASE(
+  "slice_view: r-value contiguous ranges are not collapsed to a span",
+  "[slice_view][contiguous]")
+{
+  auto sv = std::vector{10, 11, 12, 13, 14} | dd::views::slice(1, 4);
+  STATIC_REQUIRE(!std::same_as<decltype(sv), std::span<int>>);
+
+  auto expected = std::array{11, 12, 13};
+  REQUIRE(std::ranges::equal(sv, expected));
+}
+
+TEST_CASE(
+  "slice_view: strided slicing over a random access range", "[slice_view][strided]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto sv = v | dd::views::slice(1, 8, 3);
+  STATIC_REQUIRE(std::ranges::random_access_range<decltype(sv)>);
+
+  auto expected = std::array{1, 4, 7};
+  REQUIRE(std::ranges::equal(sv, expected));
+  REQUIRE(sv.size() == expected.size());
+  REQUIRE(sv.end() - sv.begin() == 3);
+  REQUIRE(sv[2] == 7);
+
+  auto reversed = std::array{7, 4, 1};
+  REQUIRE(std::ranges::equal(sv | std::views::reverse, reversed));
+}
+
+TEST_CASE(
+  "slice_view: strided slicing over a forward range", "[slice_view][strided]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto sv = dd::ranges::slice_view{lst, 1, 9, 3};
+  STATIC_REQUIRE(std::ranges::forward_range<decltype(sv)>);
+  STATIC_REQUIRE(!std::ranges::bidirectional_range<decltype(sv)>);
+
+  auto expected = std::array{1, 4, 7};
+  REQUIRE(std::ranges::equal(sv, expected));
+  REQUIRE(sv.size() == expected.size());
+}
+
+TEST_CASE(
+  "slice_view: strided slicing clamps to the end of the base",
+  "[slice_view][strided][bounds]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto sv = v | dd::views::slice(7, 100, 2);
+  auto expected = std::array{7, 9};
+  REQUIRE(std::ranges::equal(sv, expected));
+  REQUIRE(sv.size() == expected.size());
+  REQUIRE(std::ranges::empty(v | dd::views::slice(10, 20, 2)));
+}
+
+TEST_CASE("slice_view: negative indices count from the end", "[slice_view][from_end]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto expected = std::array{6, 7, 8};
+  REQUIRE(std::ranges::equal(v | dd::views::slice(-4, -1), expected));
+  REQUIRE(std::ranges::equal(lst | dd::views::slice(-4, -1), expected));
+
+  auto tail = std::array{7, 8, 9};
+  auto sv = lst | dd::views::slice(dd::ranges::from_end(3), dd::ranges::from_end(0));
+  REQUIRE(std::ranges::equal(sv, tail));
+  REQUIRE(sv.size() == tail.size());
+}
+
+TEST_CASE(
+  "slice_view: mixed front and from-end indices", "[slice_view][from_end][bounds]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto middle = std::array{2, 3, 4, 5, 6, 7};
+  REQUIRE(std::ranges::equal(lst | dd::views::slice(2, -2), middle));
+  REQUIRE((lst | dd::views::slice(2, -2)).size() == middle.size());
+
+  auto tail = std::array{7, 8};
+  REQUIRE(std::ranges::equal(lst | dd::views::slice(-3, 9), tail));
+
+  auto head = std::array{0, 1};
+  REQUIRE(std::ranges::equal(lst | dd::views::slice(-20, 2), head));
+
+  // The ending index precedes the starting index.
+  REQUIRE(std::ranges::empty(lst | dd::views::slice(8, -5)));
+  REQUIRE(std::ranges::empty(lst | dd::views::slice(-2, 3)));
+  REQUIRE((lst | dd::views::slice(8, -5)).size() == 0);
+}
+
+TEST_CASE(
+  "slice_view: from-end indices step back from the end", "[slice_view][from_end]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 100) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+
+  // One predicate call for filter_view::begin() and one per decrement.
+  auto sv = counted | dd::views::slice(-3, dd::ranges::from_end(0));
+  [[maybe_unused]] auto first = sv.begin();
+  [[maybe_unused]] auto last = sv.end();
+  REQUIRE(increments == 4);
+
+  auto tail = std::array{97, 98, 99};
+  REQUIRE(std::ranges::equal(sv, tail));
+}
+
+TEST_CASE(
+  "slice_view: from-end indices over a forward range", "[slice_view][from_end]")
+{
+  auto flst = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto tail = std::array{7, 8, 9};
+  REQUIRE(std::ranges::equal(flst | dd::views::slice(-3, dd::ranges::from_end(0)), tail));
+
+  auto middle = std::array{2, 3, 4, 5, 6, 7};
+  REQUIRE(std::ranges::equal(flst | dd::views::slice(2, -2), middle));
+}
+
+TEST_CASE(
+  "slice_view: concurrent policy shares cached iterators across threads",
+  "[slice_view][concurrent]")
+{
+  constexpr auto thread_count = 8;
+
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  const auto sv = lst | dd::views::slice_with<dd::ranges::concurrent_slice_policy>(2, 6);
+
+  auto sums = std::vector<int>(thread_count);
+  {
+    auto threads = std::vector<std::jthread>{};
+    for (auto i = 0; i < thread_count; ++i)
+    {
+      threads.emplace_back(
+        [&, i]
+        {
+          for (auto x : sv)
+          {
+            sums[i] += x;
+          }
+        });
+    }
+  }
+
+  for (auto sum : sums)
+  {
+    REQUIRE(sum == 2 + 3 + 4 + 5);
+  }
+  REQUIRE(sv.begin() == std::ranges::next(lst.begin(), 2));
+}
+
+TEST_CASE("slice_view: slice of a slice is fused", "[slice_view][fusion]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto sv = lst | dd::views::slice(1, 8) | dd::views::slice(2, 4);
+  STATIC_REQUIRE(std::same_as<decltype(sv), decltype(lst | dd::views::slice(0, 1))>);
+  REQUIRE(sv.start_index() == 3);
+  REQUIRE(sv.end_index() == 5);
+
+  auto expected = std::array{3, 4};
+  REQUIRE(std::ranges::equal(sv, expected));
+  REQUIRE(std::ranges::empty(lst | dd::views::slice(1, 3) | dd::views::slice(5, 7)));
+
+  auto tail = std::array{6, 7, 8};
+  REQUIRE(std::ranges::equal(
+    lst | dd::views::slice(1, -1) | dd::views::slice(-3, dd::ranges::from_end(0)), tail));
+}
+
+TEST_CASE(
+  "slice_view: slice of a slice over an unsized range is fused", "[slice_view][fusion]")
+{
+  auto flst = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto expected = std::array{4, 5};
+  auto sv = flst | dd::views::slice(2, 8) | dd::views::slice(2, 4);
+  STATIC_REQUIRE(std::same_as<decltype(sv), decltype(flst | dd::views::slice(0, 1))>);
+  REQUIRE(std::ranges::equal(sv, expected));
+
+  auto tail = std::array{6, 7};
+  REQUIRE(std::ranges::equal(
+    flst | dd::views::slice(2, 8) | dd::views::slice(-2, dd::ranges::from_end(0)), tail));
+
+  // Slices of unsized input ranges are nested, so that nothing is read by the adaptor.
+  auto stream = std::istringstream{"0 1 2 3 4 5 6 7 8 9"};
+  auto nested = std::views::istream<int>(stream) | dd::views::slice(1, 8) |
+                dd::views::slice(2, 4);
+  STATIC_REQUIRE(dd::ranges::detail::is_slice_view<decltype(std::move(nested).base())>);
+  REQUIRE(stream.tellg() == 0);
+  auto values = std::vector<int>{};
+  for (auto x : nested)
+  {
+    values.push_back(x);
+  }
+  REQUIRE(values == std::vector{3, 4});
+}
+
+TEST_CASE(
+  "slice_view: slices of drop and take views slice their base", "[slice_view][fusion]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  using list_slice = decltype(lst | dd::views::slice(0, 1));
+
+  auto dropped = lst | std::views::drop(2) | dd::views::slice(1, 3);
+  STATIC_REQUIRE(std::same_as<decltype(dropped), list_slice>);
+  REQUIRE(std::ranges::equal(dropped, std::array{3, 4}));
+
+  auto taken = lst | std::views::take(5) | dd::views::slice(-2, dd::ranges::from_end(0));
+  STATIC_REQUIRE(std::same_as<decltype(taken), list_slice>);
+  REQUIRE(std::ranges::equal(taken, std::array{3, 4}));
+
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto sv = v | std::views::drop(2) | dd::views::slice(1, 3);
+  STATIC_REQUIRE(std::same_as<decltype(sv), std::span<int>>);
+  REQUIRE(std::ranges::equal(sv, std::array{3, 4}));
+}
+
+TEST_CASE(
+  "slice_view: slices of iota views and subranges keep their type",
+  "[slice_view][fusion]")
+{
+  auto iota = std::views::iota(0, 100) | dd::views::slice(10, 13);
+  STATIC_REQUIRE(std::same_as<decltype(iota), std::ranges::iota_view<int, int>>);
+  REQUIRE(std::ranges::equal(iota, std::array{10, 11, 12}));
+
+  auto dq = std::deque{0, 1, 2, 3, 4, 5};
+  auto sub = std::ranges::subrange(dq.begin(), dq.end()) | dd::views::slice(1, -2);
+  STATIC_REQUIRE(
+    std::same_as<decltype(sub), std::ranges::subrange<std::deque<int>::iterator>>);
+  REQUIRE(std::ranges::equal(sub, std::array{1, 2, 3}));
+}
+
+TEST_CASE(
+  "slice_view: slice_c yields static-extent spans of arrays", "[slice_view][static]")
+{
+  auto packet = std::array<std::byte, 16>{};
+  auto header = packet | dd::views::slice_c<2, 6>;
+  STATIC_REQUIRE(std::same_as<decltype(header), std::span<std::byte, 4>>);
+  REQUIRE(header.data() == packet.data() + 2);
+
+  auto values = std::array{10, 11, 12, 13, 14, 15};
+  const auto& cvalues = values;
+  auto tail = cvalues | dd::views::slice_c<-2, dd::ranges::from_end(0)>;
+  STATIC_REQUIRE(std::same_as<decltype(tail), std::span<const int, 2>>);
+  REQUIRE(std::ranges::equal(tail, std::array{14, 15}));
+
+  auto inner = std::span(values) | dd::views::slice_c<1, 4> | dd::views::slice_c<1, 3>;
+  STATIC_REQUIRE(std::same_as<decltype(inner), std::span<int, 2>>);
+  REQUIRE(std::ranges::equal(inner, std::array{12, 13}));
+}
+
+TEST_CASE(
+  "slice_view: slice_c falls back to slice without a static extent",
+  "[slice_view][static]")
+{
+  auto v = std::vector{10, 11, 12, 13, 14};
+  auto sv = v | dd::views::slice_c<1, 4>;
+  STATIC_REQUIRE(std::same_as<decltype(sv), std::span<int>>);
+  REQUIRE(std::ranges::equal(sv, std::array{11, 12, 13}));
+
+  auto lst = std::list{10, 11, 12, 13, 14};
+  auto ls = lst | dd::views::slice_c<3, 10>;
+  REQUIRE(std::ranges::equal(ls, std::array{13, 14}));
+}
+
+TEST_CASE(
+  "slice_view: advance_window moves the cached iterators", "[slice_view][window]")
+{
+  auto increments = 0;
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto counted = lst | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+  auto window = dd::ranges::slice_view(counted, 2, 5);
+  REQUIRE(*window.begin() == 2);
+  REQUIRE(*window.end() == 5);
+  REQUIRE(increments == 6);
+
+  // Both cached iterators advance by one, instead of walking from the beginning, and
+  // the length of the window stays known.
+  window.advance_window(1);
+  REQUIRE(increments == 8);
+  REQUIRE(*window.begin() == 3);
+  REQUIRE(*window.end() == 6);
+  REQUIRE(window.size() == 3);
+  REQUIRE(increments == 8);
+  REQUIRE(std::ranges::equal(window, std::array{3, 4, 5}));
+
+  // Bidirectional ranges step back.
+  window.advance_window(-2);
+  REQUIRE(std::ranges::equal(window, std::array{1, 2, 3}));
+
+  window.shrink_front(2);
+  REQUIRE(window.start_index() == 3);
+  REQUIRE(std::ranges::equal(window, std::array{3}));
+}
+
+TEST_CASE("slice_view: set_bounds clamps and relocates", "[slice_view][window]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto window = dd::ranges::slice_view(fl, 6, 9);
+  REQUIRE(window.size() == 3);
+
+  window.set_bounds(8, 12);
+  REQUIRE(std::ranges::equal(window, std::array{8, 9}));
+  REQUIRE(window.size() == 2);
+
+  // Moving backwards over a forward range locates the slice again.
+  window.set_bounds(1, 3);
+  REQUIRE(std::ranges::equal(window, std::array{1, 2}));
+
+  window.set_bounds(-3, dd::ranges::from_end(0));
+  REQUIRE(std::ranges::equal(window, std::array{7, 8, 9}));
+
+  // Moving the cached end to the end of the base does not give the length.
+  window.set_bounds(2, 5);
+  REQUIRE(std::ranges::equal(window, std::array{2, 3, 4}));
+  window.set_bounds(2, dd::ranges::from_end(0));
+  REQUIRE(window.size() == 8);
+  REQUIRE(std::ranges::equal(window, std::array{2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_CASE("slice_view: prefetching slices of node-based ranges", "[slice_view][prefetch]")
+{
+  using policy = dd::ranges::prefetching_slice_policy<4>;
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto sliced = lst | dd::views::slice_with<policy>(2, 8);
+  STATIC_REQUIRE(std::same_as<
+                 decltype(sliced.begin()),
+                 dd::ranges::prefetch_iterator<std::list<int>::iterator>>);
+  STATIC_REQUIRE(std::ranges::bidirectional_range<decltype(sliced)>);
+  REQUIRE(std::ranges::equal(sliced, std::array{2, 3, 4, 5, 6, 7}));
+  REQUIRE(sliced.size() == 6);
+
+  // The lead iterator is bounded by the end of the slice, and decrements only move the
+  // current position.
+  auto iter = std::ranges::next(sliced.begin(), 5);
+  REQUIRE(*iter == 7);
+  REQUIRE(*--iter == 6);
+  REQUIRE(std::ranges::next(iter, 2) == sliced.end());
+
+  // Contiguous ranges still collapse to a std::span.
+  auto v = std::vector{0, 1, 2, 3, 4};
+  STATIC_REQUIRE(
+    std::same_as<decltype(v | dd::views::slice_with<policy>(1, 3)), std::span<int>>);
+}
+
+TEST_CASE("slice_view: borrowed bases make borrowed slices", "[slice_view][borrowed]")
+{
+  using span_slice = dd::ranges::slice_view<std::span<int>>;
+  using list_slice = dd::ranges::slice_view<std::ranges::ref_view<std::list<int>>>;
+  using owning_slice = dd::ranges::slice_view<std::ranges::owning_view<std::vector<int>>>;
+  using iota_slice = dd::ranges::slice_view<std::ranges::iota_view<int, int>>;
+  STATIC_REQUIRE(std::ranges::borrowed_range<span_slice>);
+  STATIC_REQUIRE(std::ranges::borrowed_range<list_slice>);
+  STATIC_REQUIRE(std::ranges::borrowed_range<iota_slice>);
+  STATIC_REQUIRE(!std::ranges::borrowed_range<owning_slice>);
+
+  // Copies neither allocate nor throw, since the caches are reset.
+  STATIC_REQUIRE(std::is_nothrow_copy_constructible_v<span_slice>);
+  STATIC_REQUIRE(std::is_nothrow_copy_constructible_v<list_slice>);
+
+  // Algorithms on temporary slices return iterators into the base.
+  auto lst = std::list{0, 1, 2, 3, 4, 5};
+  auto found = std::ranges::find(dd::ranges::slice_view(lst, 1, 5), 3);
+  STATIC_REQUIRE(std::same_as<decltype(found), std::list<int>::iterator>);
+  REQUIRE(*found == 3);
+}
+
+TEST_CASE("slice_view: reverse iteration shares the cached end", "[slice_view][reverse]")
+{
+  auto lst = std::list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto predicate_calls = 0;
+  auto bounded = lst | std::views::take_while([&](int x) {
+                   ++predicate_calls;
+                   return x < 9;
+                 });
+  STATIC_REQUIRE(!std::ranges::common_range<decltype(bounded)>);
+
+  // Only the first call locates the end of a slice of a non-common base.
+  auto sv = bounded | dd::views::slice(2, 7);
+  REQUIRE(*sv.rbegin() == 6);
+  const auto calls = predicate_calls;
+  REQUIRE(calls > 0);
+  REQUIRE(*sv.rbegin() == 6);
+  REQUIRE(*std::ranges::rbegin(sv) == 6);
+  REQUIRE(std::ranges::equal(sv.reversed(), std::array{6, 5, 4, 3, 2}));
+  REQUIRE(predicate_calls == calls);
+
+  // The reversed subrange keeps its positions when copied.
+  auto latest = sv.reversed();
+  auto copy = latest;
+  REQUIRE(std::ranges::equal(copy | std::views::take(2), std::array{6, 5}));
+  REQUIRE(predicate_calls == calls);
+
+  // Sized and strided slices are reversed with their sizes.
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto tail = dd::ranges::slice_view(lst, -3, dd::ranges::from_end(0)).reversed();
+  REQUIRE(tail.size() == 3);
+  REQUIRE(std::ranges::equal(tail, std::array{9, 8, 7}));
+  auto strided = (v | dd::views::slice(1, 8, 3)).reversed();
+  REQUIRE(strided.size() == 3);
+  REQUIRE(std::ranges::equal(strided, std::array{7, 4, 1}));
+}
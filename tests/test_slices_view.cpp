@@ -0,0 +1,114 @@
+/**
+ * @file test_slices_view.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/slices_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <cstddef>
+#include <forward_list>
+#include <ranges>
+#include <vector>
+
+TEST_CASE("slices_view: chunks of a random access range", "[slices_view]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto chunks = v | dd::views::slices(4);
+  STATIC_REQUIRE(std::ranges::random_access_range<decltype(chunks)>);
+  STATIC_REQUIRE(std::ranges::sized_range<decltype(chunks)>);
+  STATIC_REQUIRE(std::ranges::common_range<decltype(chunks)>);
+
+  REQUIRE(chunks.size() == 3);
+  REQUIRE(std::ranges::equal(chunks[0], std::array{0, 1, 2, 3}));
+  REQUIRE(std::ranges::equal(chunks[2], std::array{8, 9}));
+  REQUIRE(std::ranges::equal(chunks[1], std::array{4, 5, 6, 7}));
+  REQUIRE(std::ranges::empty(chunks.chunk(3)));
+}
+
+TEST_CASE("slices_view: const chunks of a random access range", "[slices_view]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4, 5, 6};
+  const auto chunks = v | dd::views::slices(3);
+  STATIC_REQUIRE(std::ranges::random_access_range<decltype(chunks)>);
+  STATIC_REQUIRE(std::ranges::sized_range<decltype(chunks)>);
+  STATIC_REQUIRE(std::ranges::common_range<decltype(chunks)>);
+
+  REQUIRE(chunks.size() == 3);
+  REQUIRE(std::ranges::equal(chunks[1], std::array{3, 4, 5}));
+  auto sizes = std::vector<std::size_t>{};
+  for (auto chunk : chunks)
+  {
+    sizes.push_back(chunk.size());
+  }
+  REQUIRE(sizes == std::vector<std::size_t>{3, 3, 1});
+
+  // Chunks of a forward base may discover boundaries, so they are not const.
+  auto fl = std::forward_list{0, 1, 2};
+  STATIC_REQUIRE(!std::ranges::range<decltype(fl | dd::views::slices(2)) const>);
+}
+
+TEST_CASE("slices_view: chunks of a forward range", "[slices_view]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5, 6};
+  auto chunks = dd::ranges::slices_view(fl, 3);
+  STATIC_REQUIRE(std::ranges::random_access_range<decltype(chunks)>);
+
+  auto expected = std::vector<std::vector<int>>{{0, 1, 2}, {3, 4, 5}, {6}};
+  auto k = std::size_t{0};
+  for (auto chunk : chunks)
+  {
+    REQUIRE(std::ranges::equal(chunk, expected[k]));
+    ++k;
+  }
+  REQUIRE(k == expected.size());
+  REQUIRE(chunks.size() == expected.size());
+}
+
+TEST_CASE("slices_view: exact multiples and empty ranges", "[slices_view][bounds]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5};
+  auto chunks = fl | dd::views::slices(3);
+  REQUIRE(chunks.size() == 2);
+  REQUIRE(std::ranges::distance(chunks) == 2);
+  REQUIRE(std::ranges::equal(chunks[1], std::array{3, 4, 5}));
+
+  auto empty = std::forward_list<int>{};
+  auto no_chunks = empty | dd::views::slices(3);
+  REQUIRE(no_chunks.begin() == no_chunks.end());
+  REQUIRE(no_chunks.size() == 0);
+}
+
+TEST_CASE("slices_view: boundaries are memoized", "[slices_view][cache]")
+{
+  auto increments = 0;
+  auto counted = std::views::iota(0, 100) | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+  auto chunks = counted | dd::views::slices(10);
+
+  // Chunk 5 discovers the boundaries up to its end: begin() of the filter and 60
+  // increments.
+  REQUIRE(*chunks[5].begin() == 50);
+  REQUIRE(*chunks[5].end() == 60);
+  REQUIRE(increments == 61);
+
+  // Earlier chunks are seeded with the memoized boundaries, and do not walk the base.
+  REQUIRE(*chunks[2].begin() == 20);
+  REQUIRE(*chunks[2].end() == 30);
+  REQUIRE(increments == 61);
+
+  // The number of chunks discovers the remaining boundaries once: the last increment
+  // reaches the end of the filter, without evaluating the predicate.
+  REQUIRE(chunks.size() == 10);
+  REQUIRE(chunks.size() == 10);
+  REQUIRE(increments == 100);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file test_to.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/to.hpp"
+#include "dd/copy_slice.hpp"
+#include "dd/slice_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <array>
+#include <forward_list>
+#include <list>
+#include <ranges>
+#include <sstream>
+#include <vector>
+
+TEST_CASE("reserve_hint: slices that are not sized", "[to][reserve_hint]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto lazy = fl | dd::views::lazy_slice(2, 6);
+  STATIC_REQUIRE(!std::ranges::sized_range<decltype(lazy)>);
+  STATIC_REQUIRE(dd::ranges::approximately_sized_range<decltype(lazy)>);
+  REQUIRE(dd::ranges::reserve_hint(lazy) == 4);
+
+  // The hint is an upper bound.
+  auto past_end = fl | dd::views::lazy_slice(8, 20);
+  REQUIRE(dd::ranges::reserve_hint(past_end) == 12);
+
+  // Without traversing the base, nothing is known about slices to the end.
+  auto to_end = fl | dd::views::lazy_slice(2, dd::ranges::from_end(0));
+  REQUIRE(dd::ranges::reserve_hint(to_end) == 0);
+
+  auto stream = std::istringstream{"0 1 2 3 4 5"};
+  auto input = std::views::istream<int>(stream) | dd::views::slice(1, 4);
+  REQUIRE(dd::ranges::reserve_hint(input) == 3);
+
+  // Indices past the end of a base are clamped by the hint of the base.
+  auto short_stream = std::istringstream{"0 1 2 3 4"};
+  auto nested = std::views::istream<int>(short_stream) | dd::views::slice(0, 5) |
+                dd::views::slice(2, 1'000'000);
+  REQUIRE(dd::ranges::reserve_hint(nested) == 3);
+  REQUIRE(dd::ranges::to<std::vector>(nested).capacity() == 3);
+
+  // Sized ranges hint their size, and strided hints count the steps.
+  auto sliced = fl | dd::views::slice(1, 8, 3);
+  REQUIRE(dd::ranges::reserve_hint(sliced) == 3);
+  REQUIRE(sliced.reserve_hint() == 3);
+  auto v = std::vector{0, 1, 2};
+  REQUIRE(dd::ranges::reserve_hint(v) == 3);
+}
+
+TEST_CASE("to: reserves the hint of slices once", "[to][reserve_hint]")
+{
+  auto predicate_calls = 0;
+  auto lst = std::list<int>{};
+  for (auto i = 0; i < 100; ++i)
+  {
+    lst.push_back(i);
+  }
+  auto evens = lst | std::views::filter([&](int x) {
+                 ++predicate_calls;
+                 return x % 2 == 0;
+               });
+
+  // The elements are visited once, without reallocating the vector.
+  auto collected = dd::ranges::to<std::vector>(evens | dd::views::lazy_slice(10, 30));
+  REQUIRE(predicate_calls == 61);
+  REQUIRE(collected.size() == 20);
+  REQUIRE(collected.capacity() == 20);
+  REQUIRE(collected.front() == 20);
+  REQUIRE(collected.back() == 58);
+
+  auto piped = evens | dd::views::lazy_slice(0, 3) | dd::ranges::to<std::vector<int>>();
+  REQUIRE(piped == std::vector{0, 2, 4});
+  REQUIRE(piped.capacity() == 3);
+
+  // Slices of forward ranges are sized by counting, so their hint comes from the
+  // indices, without traversing the base.
+  predicate_calls = 0;
+  auto sized = evens | dd::views::slice(10, 30);
+  STATIC_REQUIRE(std::ranges::sized_range<decltype(sized)>);
+  REQUIRE(dd::ranges::reserve_hint(sized) == 20);
+  REQUIRE(predicate_calls == 0);
+  auto counted = dd::ranges::slice_to<std::vector<int>>(sized);
+  REQUIRE(counted.size() == 20);
+  REQUIRE(counted.capacity() == 20);
+
+  // Other ranges are materialized by std::ranges::to.
+  auto all = lst | dd::ranges::to<std::vector>();
+  REQUIRE(all.size() == 100);
+  auto copy = dd::ranges::to<std::list<int>>(std::array{1, 2, 3});
+  REQUIRE(copy == std::list{1, 2, 3});
+}
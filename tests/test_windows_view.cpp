@@ -0,0 +1,68 @@
+/**
+ * @file test_windows_view.cpp
+ * @copyright Copyright (c) 2025, Devin DeLong. All rights reserved.
+ *
+ * @license This code is distributed under the BSD 3-Clause License.
+ *          See the LICENSE file for the full text of the license.
+ *
+ * @author Devin DeLong
+ */
+
+#include "dd/windows_view.hpp"
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <forward_list>
+#include <ranges>
+#include <vector>
+
+TEST_CASE("windows_view: full windows of a forward range", "[windows_view]")
+{
+  auto fl = std::forward_list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto windows = fl | dd::views::windows(4, 3);
+  STATIC_REQUIRE(std::ranges::forward_range<decltype(windows)>);
+
+  auto expected = std::vector<std::vector<int>>{{0, 1, 2, 3}, {3, 4, 5, 6}, {6, 7, 8, 9}};
+  auto k = std::size_t{0};
+  for (auto window : windows)
+  {
+    REQUIRE(k < expected.size());
+    REQUIRE(std::ranges::equal(window, expected[k]));
+    ++k;
+  }
+  REQUIRE(k == expected.size());
+}
+
+TEST_CASE("windows_view: sized bases and short ranges", "[windows_view][bounds]")
+{
+  auto v = std::vector{0, 1, 2, 3, 4};
+  auto windows = dd::ranges::windows_view(v, 2, 1);
+  REQUIRE(windows.size() == 4);
+  REQUIRE(std::ranges::distance(windows) == 4);
+
+  auto short_range = std::forward_list{0, 1};
+  auto none = short_range | dd::views::windows(3);
+  REQUIRE(none.begin() == none.end());
+}
+
+TEST_CASE("windows_view: a full scan is linear", "[windows_view][cache]")
+{
+  auto increments = 0;
+  auto fl = std::forward_list<int>(100);
+  auto counted = fl | std::views::filter([&](int) {
+                   ++increments;
+                   return true;
+                 });
+
+  auto count = 0;
+  auto windows = counted | dd::views::windows(10);
+  for (auto window : windows)
+  {
+    count += static_cast<int>(std::ranges::distance(window));
+  }
+  REQUIRE(count == 91 * 10);
+
+  // Each window visits its own elements, and moving a window costs two increments,
+  // instead of walking from the beginning of the base for every window.
+  REQUIRE(increments < 91 * 10 + 3 * 100);
+}